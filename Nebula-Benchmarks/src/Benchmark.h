@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace Nebula::Benchmarks {
+	// Best of runs, in milliseconds. The fastest run is the one the rest of the machine disturbed least
+	template<typename Function>
+	double Measure(uint32_t runs, Function&& function) {
+		double best = 0.0;
+		for (uint32_t i = 0; i < runs; i++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			function();
+			double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+			if (i == 0 || elapsed < best)
+				best = elapsed;
+		}
+
+		return best;
+	}
+
+	// Keeps results alive so the optimiser can't drop the work being timed
+	inline volatile uint64_t g_Sink = 0;
+
+	void RunTagIndex();
+	void RunRenderExtraction();
+	void RunFlatHashMap();
+}
@@ -0,0 +1,94 @@
+#include "Benchmark.h"
+
+#include "Nebula/Core/Log.h"
+#include "Nebula/Core/UUID.h"
+#include "Nebula/Utils/FlatHashMap.h"
+
+#include "entt.hpp"
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace Nebula::Benchmarks {
+	static const uint32_t s_Entries = 1000000;
+
+	struct MapTimes {
+		double Insert = 0.0, Hit = 0.0, Miss = 0.0, Erase = 0.0;
+	};
+
+	// Each phase is timed on its own, every run starts from an empty map
+	template<typename Map, typename Value>
+	static MapTimes MeasureMap(const std::vector<UUID>& keys, const std::vector<UUID>& absent, const Value& value) {
+		std::vector<UUID> shuffled = keys;
+		std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(5));
+
+		MapTimes best;
+		for (uint32_t run = 0; run < 5; run++)
+		{
+			Map map;
+			double insert = Measure(1, [&]() {
+				for (UUID key : keys)
+					map[key] = value;
+			});
+
+			double hit = Measure(1, [&]() {
+				for (UUID key : shuffled)
+					g_Sink += map.find(key) != map.end();
+			});
+
+			double miss = Measure(1, [&]() {
+				for (UUID key : absent)
+					g_Sink += map.find(key) != map.end();
+			});
+
+			double erase = Measure(1, [&]() {
+				for (UUID key : shuffled)
+					g_Sink += map.erase(key);
+			});
+
+			if (run == 0)
+				best = { insert, hit, miss, erase };
+
+			best.Insert = std::min(best.Insert, insert);
+			best.Hit = std::min(best.Hit, hit);
+			best.Miss = std::min(best.Miss, miss);
+			best.Erase = std::min(best.Erase, erase);
+		}
+
+		return best;
+	}
+
+	static void Report(const char* name, const MapTimes& times) {
+		NB_INFO("  {0:<20} insert {1:8.2f}  hit {2:8.2f}  miss {3:8.2f}  erase {4:8.2f} ms", name, times.Insert, times.Hit, times.Miss, times.Erase);
+	}
+
+	// The tables FlatHashMap replaced: UUID -> entity, UUID -> Ref<>. Sequential keys are the case it loses
+	void RunFlatHashMap() {
+		std::mt19937_64 random(7);
+		std::vector<UUID> keys, absent, sequential, sequentialAbsent;
+		for (uint32_t i = 0; i < s_Entries; i++)
+		{
+			keys.push_back(random());
+			absent.push_back(random());
+			sequential.push_back(i + 1);
+			sequentialAbsent.push_back(s_Entries + i + 1);
+		}
+
+		NB_INFO("[FlatHashMap] {0} entries, best of 5", s_Entries);
+
+		NB_INFO(" random UUIDs -> entity");
+		Report("std::unordered_map", MeasureMap<std::unordered_map<UUID, entt::entity>>(keys, absent, entt::entity{ 5 }));
+		Report("FlatHashMap", MeasureMap<FlatHashMap<UUID, entt::entity>>(keys, absent, entt::entity{ 5 }));
+
+		Ref<int> ref = CreateRef<int>(5);
+		NB_INFO(" random UUIDs -> Ref<>");
+		Report("std::unordered_map", MeasureMap<std::unordered_map<UUID, Ref<int>>>(keys, absent, ref));
+		Report("FlatHashMap", MeasureMap<FlatHashMap<UUID, Ref<int>>>(keys, absent, ref));
+
+		NB_INFO(" sequential keys -> entity");
+		Report("std::unordered_map", MeasureMap<std::unordered_map<UUID, entt::entity>>(sequential, sequentialAbsent, entt::entity{ 5 }));
+		Report("FlatHashMap", MeasureMap<FlatHashMap<UUID, entt::entity>>(sequential, sequentialAbsent, entt::entity{ 5 }));
+	}
+}
@@ -0,0 +1,31 @@
+#include "Nebula/Core/Log.h"
+
+#include "Benchmark.h"
+
+#include <string_view>
+
+// Runs every benchmark, or only the ones named on the command line: tags, extraction, hashmap.
+// Build in Release or Dist, Debug numbers say nothing about the shipped engine
+int main(int argc, char** argv) {
+	Nebula::Log::Init();
+
+	auto selected = [&](std::string_view name) {
+		if (argc < 2)
+			return true;
+
+		for (int i = 1; i < argc; i++)
+		{
+			if (name == argv[i])
+				return true;
+		}
+
+		return false;
+	};
+
+	if (selected("tags"))
+		Nebula::Benchmarks::RunTagIndex();
+	if (selected("extraction"))
+		Nebula::Benchmarks::RunRenderExtraction();
+	if (selected("hashmap"))
+		Nebula::Benchmarks::RunFlatHashMap();
+}
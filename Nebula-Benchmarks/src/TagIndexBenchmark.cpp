@@ -0,0 +1,62 @@
+#include "Benchmark.h"
+
+#include "Nebula/Core/Log.h"
+#include "Nebula/Scene/Components.h"
+#include "Nebula/Scene/Scene_TagIndex.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Nebula::Benchmarks {
+	static const uint32_t s_TaggedEntities = 100000;
+	static const uint32_t s_DistinctNames = 50000;
+	static const uint32_t s_Lookups = 1000;
+
+	// Scene::GetEntityWithTag before and after the tag index: a string compare against every tag,
+	// against interning the query and reading the first entity of its bucket
+	void RunTagIndex() {
+		entt::registry registry;
+		SceneTagIndex index;
+		std::mt19937 random(3);
+
+		for (uint32_t i = 0; i < s_TaggedEntities; i++)
+		{
+			entt::entity entity = registry.create();
+			registry.emplace<TagComponent>(entity, NameID("Entity " + std::to_string(random() % s_DistinctNames)));
+			index.Add(registry, entity);
+		}
+
+		auto tags = registry.view<TagComponent>();
+		std::vector<std::string> queries;
+		for (uint32_t i = 0; i < s_Lookups; i++)
+			queries.push_back(tags.get(tags.data()[random() % tags.size()]).Tag.GetString());
+
+		double scan = Measure(10, [&]() {
+			for (const std::string& query : queries)
+			{
+				for (entt::entity entity : tags)
+				{
+					if (tags.get(entity).Tag.GetString() == query)
+					{
+						g_Sink = (uint64_t)entity;
+						break;
+					}
+				}
+			}
+		});
+
+		double indexed = Measure(10, [&]() {
+			for (const std::string& query : queries)
+			{
+				NameID name;
+				if (NameID::Find(query, name) && !index.Find(name).empty())
+					g_Sink = (uint64_t)index.Find(name).front();
+			}
+		});
+
+		NB_INFO("[Tag Index] {0} lookups over {1} entities with {2} names", s_Lookups, s_TaggedEntities, s_DistinctNames);
+		NB_INFO("  string scan   {0:.3f} ms", scan);
+		NB_INFO("  tag index     {0:.3f} ms", indexed);
+	}
+}
@@ -85,318 +85,332 @@ namespace Nebula
         internal extern static ulong Scene_CreateNewEntity(string name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static ulong Scene_DuplicateEntity(ulong entityID);
+        internal extern static ulong Scene_DuplicateEntity(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Scene_DestroyEntity(ulong entityID);
+        internal extern static void Scene_DestroyEntity(ref EntityHandle entity);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void Scene_DespawnEntity(ref EntityHandle entity);
         #endregion
 
         #region Entity
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool Entity_HasComponent(ulong entityID, Type component);
+        internal extern static bool Entity_HasComponent(ref EntityHandle entity, Type component);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool Entity_AddComponent(ulong entityID, Type component);
+        internal extern static bool Entity_AddComponent(ref EntityHandle entity, Type component);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static string Entity_GetName(ulong entityID);
+        internal extern static string Entity_GetName(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Entity_SetName(ulong entityID, string name);
+        internal extern static void Entity_SetName(ref EntityHandle entity, string name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static object Entity_GetScriptInstance(ulong entityID);
+        internal extern static object Entity_GetScriptInstance(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static object Entity_SetScriptInstance(ulong entityID, Type script);
+        internal extern static object Entity_SetScriptInstance(ref EntityHandle entity, Type script);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static ulong Entity_FindChildByName(ulong entityID, string name);
+        internal extern static ulong Entity_FindChildByName(ref EntityHandle entity, string name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static short Entity_GetLayer(ulong entityID);
+        internal extern static short Entity_GetLayer(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Entity_SetLayer(ulong entityID, short layer);
+        internal extern static void Entity_SetLayer(ref EntityHandle entity, short layer);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static ulong Entity_GetChild(ulong entityID, uint index);
+        internal extern static ulong Entity_GetChild(ref EntityHandle entity, uint index);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static uint Entity_GetChildCount(ulong entityID);
+        internal extern static uint Entity_GetChildCount(ref EntityHandle entity);
         #endregion
 
         #region Prefab
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
         internal extern static ulong Prefab_Create(ulong handle);
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong[] Prefab_Instantiate(ulong handle, uint count);
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static ulong Prefab_Spawn(ulong handle);
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void Prefab_Prewarm(ulong handle, uint count);
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void Prefab_GetPoolStats(ulong handle, out PrefabPoolStats stats);
         #endregion
 
         #region TransformComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetTranslation(ulong entityID, out Vector3 translation);
+        internal extern static void TransformComponent_GetTranslation(ref EntityHandle entity, out Vector3 translation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_SetTranslation(ulong entityID, ref Vector3 translation);
+        internal extern static void TransformComponent_SetTranslation(ref EntityHandle entity, ref Vector3 translation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetRotation(ulong entityID, out Vector3 rotation);
+        internal extern static void TransformComponent_GetRotation(ref EntityHandle entity, out Vector3 rotation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_SetRotation(ulong entityID, ref Vector3 rotation);
+        internal extern static void TransformComponent_SetRotation(ref EntityHandle entity, ref Vector3 rotation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetScale(ulong entityID, out Vector3 scale);
+        internal extern static void TransformComponent_GetScale(ref EntityHandle entity, out Vector3 scale);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_SetScale(ulong entityID, ref Vector3 scale);
+        internal extern static void TransformComponent_SetScale(ref EntityHandle entity, ref Vector3 scale);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetWorldTranslation(ulong entityID, out Vector3 translation);
+        internal extern static void TransformComponent_GetWorldTranslation(ref EntityHandle entity, out Vector3 translation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetWorldRotation(ulong entityID, out Vector3 rotation);
+        internal extern static void TransformComponent_GetWorldRotation(ref EntityHandle entity, out Vector3 rotation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void TransformComponent_GetWorldScale(ulong entityID, out Vector3 scale);
+        internal extern static void TransformComponent_GetWorldScale(ref EntityHandle entity, out Vector3 scale);
         #endregion
 
         #region CameraComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool CameraComponent_GetPrimary(ulong entityID);
+        internal extern static bool CameraComponent_GetPrimary(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CameraComponent_SetPrimary(ulong entityID, bool primary);
+        internal extern static void CameraComponent_SetPrimary(ref EntityHandle entity, bool primary);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool CameraComponent_GetFixedRatio(ulong entityID);
+        internal extern static bool CameraComponent_GetFixedRatio(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CameraComponent_SetFixedRatio(ulong entityID, bool fixedRatio);
+        internal extern static void CameraComponent_SetFixedRatio(ref EntityHandle entity, bool fixedRatio);
+        
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        internal extern static void CameraComponent_ScreenToWorld(ref EntityHandle entity, Vector2 input, out Vector3 value);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CameraComponent_ScreenToWorld(ulong entityID, Vector2 input, out Vector3 value);
+        internal extern static void CameraComponent_WorldToScreen(ref EntityHandle entity, Vector3 point, out Vector2 value);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CameraComponent_WorldToScreen(ulong entityID, Vector3 point, out Vector2 value);
+        internal extern static ulong CameraComponent_PickEntity(ref EntityHandle entity, Vector2 input);
         #endregion
 
         #region SpriteRendererComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_GetColour(ulong entityID, out Vector4 colour);
+        internal extern static void SpriteRendererComponent_GetColour(ref EntityHandle entity, out Vector4 colour);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_SetColour(ulong entityID, ref Vector4 colour);
+        internal extern static void SpriteRendererComponent_SetColour(ref EntityHandle entity, ref Vector4 colour);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_GetOffset(ulong entityID, out Vector2 offset);
+        internal extern static void SpriteRendererComponent_GetOffset(ref EntityHandle entity, out Vector2 offset);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_SetOffset(ulong entityID, ref Vector2 offset);
+        internal extern static void SpriteRendererComponent_SetOffset(ref EntityHandle entity, ref Vector2 offset);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_GetCellSize(ulong entityID, out Vector2 size);
+        internal extern static void SpriteRendererComponent_GetCellSize(ref EntityHandle entity, out Vector2 size);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_SetCellSize(ulong entityID, ref Vector2 size);
+        internal extern static void SpriteRendererComponent_SetCellSize(ref EntityHandle entity, ref Vector2 size);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_GetCellNumber(ulong entityID, out Vector2 number);
+        internal extern static void SpriteRendererComponent_GetCellNumber(ref EntityHandle entity, out Vector2 number);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_SetCellNumber(ulong entityID, ref Vector2 number);
+        internal extern static void SpriteRendererComponent_SetCellNumber(ref EntityHandle entity, ref Vector2 number);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float SpriteRendererComponent_GetTiling(ulong entityID);
+        internal extern static float SpriteRendererComponent_GetTiling(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void SpriteRendererComponent_SetTiling(ulong entityID, float tiling);
+        internal extern static void SpriteRendererComponent_SetTiling(ref EntityHandle entity, float tiling);
         #endregion
 
         #region CircleRendererComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleRendererComponent_GetColour(ulong entityID, out Vector4 colour);
+        internal extern static void CircleRendererComponent_GetColour(ref EntityHandle entity, out Vector4 colour);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleRendererComponent_SetColour(ulong entityID, ref Vector4 colour);
+        internal extern static void CircleRendererComponent_SetColour(ref EntityHandle entity, ref Vector4 colour);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleRendererComponent_GetRadius(ulong entityID);
+        internal extern static float CircleRendererComponent_GetRadius(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleRendererComponent_SetRadius(ulong entityID, float radius);
+        internal extern static void CircleRendererComponent_SetRadius(ref EntityHandle entity, float radius);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleRendererComponent_GetThickness(ulong entityID);
+        internal extern static float CircleRendererComponent_GetThickness(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleRendererComponent_SetThickness(ulong entityID, float thickness);
+        internal extern static void CircleRendererComponent_SetThickness(ref EntityHandle entity, float thickness);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleRendererComponent_GetFade(ulong entityID);
+        internal extern static float CircleRendererComponent_GetFade(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleRendererComponent_SetFade(ulong entityID, float fade);
+        internal extern static void CircleRendererComponent_SetFade(ref EntityHandle entity, float fade);
         #endregion
 
         #region StringRendererComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static string StringRendererComponent_GetText(ulong entityID);
+        internal extern static string StringRendererComponent_GetText(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetText(ulong entityID, string index);
+        internal extern static void StringRendererComponent_SetText(ref EntityHandle entity, string index);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_GetColour(ulong entityID, out Vector4 colour);
+        internal extern static void StringRendererComponent_GetColour(ref EntityHandle entity, out Vector4 colour);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetColour(ulong entityID, ref Vector4 colour);
+        internal extern static void StringRendererComponent_SetColour(ref EntityHandle entity, ref Vector4 colour);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static ulong StringRendererComponent_GetFontHandle(ulong entityID);
+        internal extern static ulong StringRendererComponent_GetFontHandle(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetFontHandle(ulong entityID, ulong handle);
+        internal extern static void StringRendererComponent_SetFontHandle(ref EntityHandle entity, ulong handle);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool StringRendererComponent_GetBold(ulong entityID);
+        internal extern static bool StringRendererComponent_GetBold(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetBold(ulong entityID, bool bold);
+        internal extern static void StringRendererComponent_SetBold(ref EntityHandle entity, bool bold);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool StringRendererComponent_GetItalic(ulong entityID);
+        internal extern static bool StringRendererComponent_GetItalic(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetItalic(ulong entityID, bool italic);
+        internal extern static void StringRendererComponent_SetItalic(ref EntityHandle entity, bool italic);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float StringRendererComponent_GetKerning(ulong entityID);
+        internal extern static float StringRendererComponent_GetKerning(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetKerning(ulong entityID, float kerning);
+        internal extern static void StringRendererComponent_SetKerning(ref EntityHandle entity, float kerning);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float StringRendererComponent_GetLineSpacing(ulong entityID);
+        internal extern static float StringRendererComponent_GetLineSpacing(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void StringRendererComponent_SetLineSpacing(ulong entityID, float lineSpacing);
+        internal extern static void StringRendererComponent_SetLineSpacing(ref EntityHandle entity, float lineSpacing);
         #endregion
 
         #region Rigidbody2DComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static int Rigidbody2DComponent_GetBodyType(ulong entityID);
+        internal extern static int Rigidbody2DComponent_GetBodyType(ref EntityHandle entity);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_SetBodyType(ulong entityID, int type);
+        internal extern static void Rigidbody2DComponent_SetBodyType(ref EntityHandle entity, int type);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static bool Rigidbody2DComponent_GetFixedRotation(ulong entityID);
+        internal extern static bool Rigidbody2DComponent_GetFixedRotation(ref EntityHandle entity);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_SetFixedRotation(ulong entityID, bool fixedRotation);
+        internal extern static void Rigidbody2DComponent_SetFixedRotation(ref EntityHandle entity, bool fixedRotation);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_ApplyLinearImpulse(ulong entityID, ref Vector2 impulse, ref Vector2 point);
+        internal extern static void Rigidbody2DComponent_ApplyLinearImpulse(ref EntityHandle entity, ref Vector2 impulse, ref Vector2 point);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(ulong entityID, ref Vector2 impulse);
+        internal extern static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(ref EntityHandle entity, ref Vector2 impulse);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_GetLinearVelocity(ulong entityID, out Vector2 impulse);
+        internal extern static void Rigidbody2DComponent_GetLinearVelocity(ref EntityHandle entity, out Vector2 impulse);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_ApplyForce(ulong entityID, ref Vector2 force, ref Vector2 point);
+        internal extern static void Rigidbody2DComponent_ApplyForce(ref EntityHandle entity, ref Vector2 force, ref Vector2 point);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void Rigidbody2DComponent_ApplyForceToCenter(ulong entityID, ref Vector2 force);
+        internal extern static void Rigidbody2DComponent_ApplyForceToCenter(ref EntityHandle entity, ref Vector2 force);
         #endregion
 
         #region BoxCollider2DComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_GetSize(ulong entityID, out Vector2 size);
+        internal extern static void BoxCollider2DComponent_GetSize(ref EntityHandle entity, out Vector2 size);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetSize(ulong entityID, ref Vector2 size);
+        internal extern static void BoxCollider2DComponent_SetSize(ref EntityHandle entity, ref Vector2 size);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_GetOffset(ulong entityID, out Vector2 offset);
+        internal extern static void BoxCollider2DComponent_GetOffset(ref EntityHandle entity, out Vector2 offset);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetOffset(ulong entityID, ref Vector2 offset);
+        internal extern static void BoxCollider2DComponent_SetOffset(ref EntityHandle entity, ref Vector2 offset);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float BoxCollider2DComponent_GetDensity(ulong entityID);
+        internal extern static float BoxCollider2DComponent_GetDensity(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetDensity(ulong entityID, float density);
+        internal extern static void BoxCollider2DComponent_SetDensity(ref EntityHandle entity, float density);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float BoxCollider2DComponent_GetFriction(ulong entityID);
+        internal extern static float BoxCollider2DComponent_GetFriction(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetFriction(ulong entityID, float friction);
+        internal extern static void BoxCollider2DComponent_SetFriction(ref EntityHandle entity, float friction);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float BoxCollider2DComponent_GetRestitution(ulong entityID);
+        internal extern static float BoxCollider2DComponent_GetRestitution(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetRestitution(ulong entityID, float restitution);
+        internal extern static void BoxCollider2DComponent_SetRestitution(ref EntityHandle entity, float restitution);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float BoxCollider2DComponent_GetThreshold(ulong entityID);
+        internal extern static float BoxCollider2DComponent_GetThreshold(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetThreshold(ulong entityID, float threshold);
+        internal extern static void BoxCollider2DComponent_SetThreshold(ref EntityHandle entity, float threshold);
         
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static short BoxCollider2DComponent_GetMask(ulong entityID);
+        internal extern static short BoxCollider2DComponent_GetMask(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void BoxCollider2DComponent_SetMask(ulong entityID, short mask);
+        internal extern static void BoxCollider2DComponent_SetMask(ref EntityHandle entity, short mask);
         #endregion
 
         #region CircleCollider2DComponent
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleCollider2DComponent_GetRadius(ulong entityID);
+        internal extern static float CircleCollider2DComponent_GetRadius(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetRadius(ulong entityID, float radius);
+        internal extern static void CircleCollider2DComponent_SetRadius(ref EntityHandle entity, float radius);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_GetOffset(ulong entityID, out Vector2 offset);
+        internal extern static void CircleCollider2DComponent_GetOffset(ref EntityHandle entity, out Vector2 offset);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetOffset(ulong entityID, ref Vector2 offset);
+        internal extern static void CircleCollider2DComponent_SetOffset(ref EntityHandle entity, ref Vector2 offset);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleCollider2DComponent_GetDensity(ulong entityID);
+        internal extern static float CircleCollider2DComponent_GetDensity(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetDensity(ulong entityID, float density);
+        internal extern static void CircleCollider2DComponent_SetDensity(ref EntityHandle entity, float density);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleCollider2DComponent_GetFriction(ulong entityID);
+        internal extern static float CircleCollider2DComponent_GetFriction(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetFriction(ulong entityID, float friction);
+        internal extern static void CircleCollider2DComponent_SetFriction(ref EntityHandle entity, float friction);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleCollider2DComponent_GetRestitution(ulong entityID);
+        internal extern static float CircleCollider2DComponent_GetRestitution(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetRestitution(ulong entityID, float restitution);
+        internal extern static void CircleCollider2DComponent_SetRestitution(ref EntityHandle entity, float restitution);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static float CircleCollider2DComponent_GetThreshold(ulong entityID);
+        internal extern static float CircleCollider2DComponent_GetThreshold(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetThreshold(ulong entityID, float threshold);
+        internal extern static void CircleCollider2DComponent_SetThreshold(ref EntityHandle entity, float threshold);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static short CircleCollider2DComponent_GetMask(ulong entityID);
+        internal extern static short CircleCollider2DComponent_GetMask(ref EntityHandle entity);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        internal extern static void CircleCollider2DComponent_SetMask(ulong entityID, short mask);
+        internal extern static void CircleCollider2DComponent_SetMask(ref EntityHandle entity, short mask);
         #endregion
     }
 }
@@ -11,12 +11,12 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetTranslation(Entity.ID, out Vector3 translation);
+                InternalCalls.TransformComponent_GetTranslation(ref Entity.Handle, out Vector3 translation);
                 return translation;
             }
             set
             {
-                InternalCalls.TransformComponent_SetTranslation(Entity.ID, ref value);
+                InternalCalls.TransformComponent_SetTranslation(ref Entity.Handle, ref value);
             }
         }
         
@@ -24,12 +24,12 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetRotation(Entity.ID, out Vector3 rotation);
+                InternalCalls.TransformComponent_GetRotation(ref Entity.Handle, out Vector3 rotation);
                 return rotation;
             }
             set
             {
-                InternalCalls.TransformComponent_SetRotation(Entity.ID, ref value);
+                InternalCalls.TransformComponent_SetRotation(ref Entity.Handle, ref value);
             }
         }
         
@@ -37,12 +37,12 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetScale(Entity.ID, out Vector3 scale);
+                InternalCalls.TransformComponent_GetScale(ref Entity.Handle, out Vector3 scale);
                 return scale;
             }
             set
             {
-                InternalCalls.TransformComponent_SetScale(Entity.ID, ref value);
+                InternalCalls.TransformComponent_SetScale(ref Entity.Handle, ref value);
             }
         }
 
@@ -50,7 +50,7 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetWorldTranslation(Entity.ID, out Vector3 translation);
+                InternalCalls.TransformComponent_GetWorldTranslation(ref Entity.Handle, out Vector3 translation);
                 return translation;
             }
         }
@@ -59,7 +59,7 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetWorldRotation(Entity.ID, out Vector3 rotation);
+                InternalCalls.TransformComponent_GetWorldRotation(ref Entity.Handle, out Vector3 rotation);
                 return rotation;
             }
         }
@@ -68,7 +68,7 @@
         {
             get
             {
-                InternalCalls.TransformComponent_GetScale(Entity.ID, out Vector3 scale);
+                InternalCalls.TransformComponent_GetScale(ref Entity.Handle, out Vector3 scale);
                 return scale;
             }
         }
@@ -80,33 +80,42 @@
         
         public bool Primary
         {
-            get => InternalCalls.CameraComponent_GetPrimary(Entity.ID); 
-            set => InternalCalls.CameraComponent_SetPrimary(Entity.ID, value);
+            get => InternalCalls.CameraComponent_GetPrimary(ref Entity.Handle); 
+            set => InternalCalls.CameraComponent_SetPrimary(ref Entity.Handle, value);
         }
 
         bool FixedAspectRatio
         {
             get
             {
-                return InternalCalls.CameraComponent_GetFixedRatio(Entity.ID);
+                return InternalCalls.CameraComponent_GetFixedRatio(ref Entity.Handle);
             }
             set
             {
-                InternalCalls.CameraComponent_SetFixedRatio(Entity.ID, value);
+                InternalCalls.CameraComponent_SetFixedRatio(ref Entity.Handle, value);
             }
         }
 
         public Vector3 ToWorld(Vector2 input)
         {
-            InternalCalls.CameraComponent_ScreenToWorld(Entity.ID, input, out Vector3 value);
+            InternalCalls.CameraComponent_ScreenToWorld(ref Entity.Handle, input, out Vector3 value);
             return value;
         }
         
         public Vector2 ToScreen(Vector3 point)
         {
-            InternalCalls.CameraComponent_WorldToScreen(Entity.ID, point, out Vector2 value);
+            InternalCalls.CameraComponent_WorldToScreen(ref Entity.Handle, point, out Vector2 value);
             return value;
         }
+
+        public Entity PickEntity(Vector2 input)
+        {
+            ulong id = InternalCalls.CameraComponent_PickEntity(ref Entity.Handle, input);
+            if (id == 0)
+                return null;
+
+            return new Entity(id);
+        }
     }
 
     public class SpriteRendererComponent : Component
@@ -117,12 +126,12 @@
         {
             get 
             {
-                InternalCalls.SpriteRendererComponent_GetColour(Entity.ID, out Vector4 colour);
+                InternalCalls.SpriteRendererComponent_GetColour(ref Entity.Handle, out Vector4 colour);
                 return colour;
             }
             set
             {
-                InternalCalls.SpriteRendererComponent_SetColour(Entity.ID, ref value);
+                InternalCalls.SpriteRendererComponent_SetColour(ref Entity.Handle, ref value);
             }
         }
 
@@ -130,12 +139,12 @@
         {
             get
             {
-                InternalCalls.SpriteRendererComponent_GetOffset(Entity.ID, out Vector2 offset);
+                InternalCalls.SpriteRendererComponent_GetOffset(ref Entity.Handle, out Vector2 offset);
                 return offset;
             }
             set
             {
-                InternalCalls.SpriteRendererComponent_SetOffset(Entity.ID, ref value);
+                InternalCalls.SpriteRendererComponent_SetOffset(ref Entity.Handle, ref value);
             }
         }
 
@@ -143,12 +152,12 @@
         {
             get
             {
-                InternalCalls.SpriteRendererComponent_GetCellSize(Entity.ID, out Vector2 size);
+                InternalCalls.SpriteRendererComponent_GetCellSize(ref Entity.Handle, out Vector2 size);
                 return size;
             }
             set
             {
-                InternalCalls.SpriteRendererComponent_SetCellSize(Entity.ID, ref value);
+                InternalCalls.SpriteRendererComponent_SetCellSize(ref Entity.Handle, ref value);
             }
         }
 
@@ -156,19 +165,19 @@
         {
             get
             {
-                InternalCalls.SpriteRendererComponent_GetCellNumber(Entity.ID, out Vector2 number);
+                InternalCalls.SpriteRendererComponent_GetCellNumber(ref Entity.Handle, out Vector2 number);
                 return number;
             }
             set
             {
-                InternalCalls.SpriteRendererComponent_SetCellNumber(Entity.ID, ref value);
+                InternalCalls.SpriteRendererComponent_SetCellNumber(ref Entity.Handle, ref value);
             }
         }
 
         public float Tiling
         {
-            get => InternalCalls.SpriteRendererComponent_GetTiling(Entity.ID); 
-            set => InternalCalls.SpriteRendererComponent_SetTiling(Entity.ID, value);
+            get => InternalCalls.SpriteRendererComponent_GetTiling(ref Entity.Handle); 
+            set => InternalCalls.SpriteRendererComponent_SetTiling(ref Entity.Handle, value);
         }
     }
 
@@ -178,31 +187,31 @@
         {
             get
             {
-                InternalCalls.CircleRendererComponent_GetColour(Entity.ID, out Vector4 colour);
+                InternalCalls.CircleRendererComponent_GetColour(ref Entity.Handle, out Vector4 colour);
                 return colour;
             }
             set
             {
-                InternalCalls.CircleRendererComponent_SetColour(Entity.ID, ref value);
+                InternalCalls.CircleRendererComponent_SetColour(ref Entity.Handle, ref value);
             }
         }
 
         public float Radius
         {
-            get => InternalCalls.CircleRendererComponent_GetRadius(Entity.ID); 
-            set => InternalCalls.CircleRendererComponent_SetRadius(Entity.ID, value);
+            get => InternalCalls.CircleRendererComponent_GetRadius(ref Entity.Handle); 
+            set => InternalCalls.CircleRendererComponent_SetRadius(ref Entity.Handle, value);
         }
 
         public float Thickness
         {
-            get => InternalCalls.CircleRendererComponent_GetThickness(Entity.ID); 
-            set => InternalCalls.CircleRendererComponent_SetThickness(Entity.ID, value);
+            get => InternalCalls.CircleRendererComponent_GetThickness(ref Entity.Handle); 
+            set => InternalCalls.CircleRendererComponent_SetThickness(ref Entity.Handle, value);
         }
 
         public float Fade
         {
-            get => InternalCalls.CircleRendererComponent_GetFade(Entity.ID); 
-            set => InternalCalls.CircleRendererComponent_SetFade(Entity.ID, value);
+            get => InternalCalls.CircleRendererComponent_GetFade(ref Entity.Handle); 
+            set => InternalCalls.CircleRendererComponent_SetFade(ref Entity.Handle, value);
         }
     }
 
@@ -210,20 +219,20 @@
     {
         public string Text
         {
-            get => InternalCalls.StringRendererComponent_GetText(Entity.ID); 
-            set => InternalCalls.StringRendererComponent_SetText(Entity.ID, value);
+            get => InternalCalls.StringRendererComponent_GetText(ref Entity.Handle); 
+            set => InternalCalls.StringRendererComponent_SetText(ref Entity.Handle, value);
         }
 
         public Vector4 Colour
         {
             get
             {
-                InternalCalls.StringRendererComponent_GetColour(Entity.ID, out Vector4 colour);
+                InternalCalls.StringRendererComponent_GetColour(ref Entity.Handle, out Vector4 colour);
                 return colour;
             }
             set
             {
-                InternalCalls.StringRendererComponent_SetColour(Entity.ID, ref value);
+                InternalCalls.StringRendererComponent_SetColour(ref Entity.Handle, ref value);
             }
         }
 
@@ -231,38 +240,38 @@
         {
             get
             {
-                ulong handle = InternalCalls.StringRendererComponent_GetFontHandle(Entity.ID);
+                ulong handle = InternalCalls.StringRendererComponent_GetFontHandle(ref Entity.Handle);
                 if (handle == 0)
                     return null;
 
                 return new Font(handle);
             }
 
-            set => InternalCalls.StringRendererComponent_SetFontHandle(Entity.ID, value.AssetHandle);
+            set => InternalCalls.StringRendererComponent_SetFontHandle(ref Entity.Handle, value.AssetHandle);
         }
 
         public bool Bold
         {
-            get => InternalCalls.StringRendererComponent_GetBold(Entity.ID);
-            set => InternalCalls.StringRendererComponent_SetBold(Entity.ID, value);
+            get => InternalCalls.StringRendererComponent_GetBold(ref Entity.Handle);
+            set => InternalCalls.StringRendererComponent_SetBold(ref Entity.Handle, value);
         }
 
         public bool Italic
         {
-            get => InternalCalls.StringRendererComponent_GetItalic(Entity.ID);
-            set => InternalCalls.StringRendererComponent_SetItalic(Entity.ID, value);
+            get => InternalCalls.StringRendererComponent_GetItalic(ref Entity.Handle);
+            set => InternalCalls.StringRendererComponent_SetItalic(ref Entity.Handle, value);
         }
 
         public float Kerning
         {
-            get => InternalCalls.StringRendererComponent_GetKerning(Entity.ID);
-            set => InternalCalls.StringRendererComponent_SetKerning(Entity.ID, value);
+            get => InternalCalls.StringRendererComponent_GetKerning(ref Entity.Handle);
+            set => InternalCalls.StringRendererComponent_SetKerning(ref Entity.Handle, value);
         }
 
         public float LineSpacing
         {
-            get => InternalCalls.StringRendererComponent_GetLineSpacing(Entity.ID);
-            set => InternalCalls.StringRendererComponent_SetLineSpacing(Entity.ID, value);
+            get => InternalCalls.StringRendererComponent_GetLineSpacing(ref Entity.Handle);
+            set => InternalCalls.StringRendererComponent_SetLineSpacing(ref Entity.Handle, value);
         }
     }
 
@@ -274,25 +283,25 @@
         {
             get
             {
-                return (BodyType)InternalCalls.Rigidbody2DComponent_GetBodyType(Entity.ID);
+                return (BodyType)InternalCalls.Rigidbody2DComponent_GetBodyType(ref Entity.Handle);
             }
             set
             {
-                InternalCalls.Rigidbody2DComponent_SetBodyType(Entity.ID, (int)value);
+                InternalCalls.Rigidbody2DComponent_SetBodyType(ref Entity.Handle, (int)value);
             }
         }
 
         public bool FixedRotation
         {
-            get => InternalCalls.Rigidbody2DComponent_GetFixedRotation(Entity.ID); 
-            set => InternalCalls.Rigidbody2DComponent_SetFixedRotation(Entity.ID, value);
+            get => InternalCalls.Rigidbody2DComponent_GetFixedRotation(ref Entity.Handle); 
+            set => InternalCalls.Rigidbody2DComponent_SetFixedRotation(ref Entity.Handle, value);
         }
 
         public Vector2 LinearVelocity
         {
             get
             {
-                InternalCalls.Rigidbody2DComponent_GetLinearVelocity(Entity.ID, out Vector2 velocity);
+                InternalCalls.Rigidbody2DComponent_GetLinearVelocity(ref Entity.Handle, out Vector2 velocity);
                 return velocity;
             }
         }
@@ -307,22 +316,22 @@
 
         public void ApplyLinearImpulse(Vector2 impulse)
         {
-            InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseToCenter(Entity.ID, ref impulse);
+            InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseToCenter(ref Entity.Handle, ref impulse);
         }
         
         public void ApplyLinearImpulse(Vector2 impulse, Vector2 worldPoint)
         {
-            InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(Entity.ID, ref impulse, ref worldPoint);
+            InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(ref Entity.Handle, ref impulse, ref worldPoint);
         }
         
         public void ApplyForce(Vector2 force)
         {
-            InternalCalls.Rigidbody2DComponent_ApplyForceToCenter(Entity.ID, ref force);
+            InternalCalls.Rigidbody2DComponent_ApplyForceToCenter(ref Entity.Handle, ref force);
         }
         
         public void ApplyForce(Vector2 force, Vector2 worldPoint)
         {
-            InternalCalls.Rigidbody2DComponent_ApplyForce(Entity.ID, ref force, ref worldPoint);
+            InternalCalls.Rigidbody2DComponent_ApplyForce(ref Entity.Handle, ref force, ref worldPoint);
         }
     }
 
@@ -332,12 +341,12 @@
         {
             get
             {
-                InternalCalls.BoxCollider2DComponent_GetSize(Entity.ID, out Vector2 size);
+                InternalCalls.BoxCollider2DComponent_GetSize(ref Entity.Handle, out Vector2 size);
                 return size;
             }
             set
             {
-                InternalCalls.BoxCollider2DComponent_SetSize(Entity.ID, ref value);
+                InternalCalls.BoxCollider2DComponent_SetSize(ref Entity.Handle, ref value);
             }
         }
 
@@ -345,48 +354,48 @@
         {
             get
             {
-                InternalCalls.BoxCollider2DComponent_GetOffset(Entity.ID, out Vector2 offset);
+                InternalCalls.BoxCollider2DComponent_GetOffset(ref Entity.Handle, out Vector2 offset);
                 return offset;
             }
             set
             {
-                InternalCalls.BoxCollider2DComponent_SetOffset(Entity.ID, ref value);
+                InternalCalls.BoxCollider2DComponent_SetOffset(ref Entity.Handle, ref value);
             }
         }
 
         public float Density
         {
-            get => InternalCalls.BoxCollider2DComponent_GetDensity(Entity.ID); 
-            set => InternalCalls.BoxCollider2DComponent_SetDensity(Entity.ID, value);
+            get => InternalCalls.BoxCollider2DComponent_GetDensity(ref Entity.Handle); 
+            set => InternalCalls.BoxCollider2DComponent_SetDensity(ref Entity.Handle, value);
         }
 
         public float Friction
         {
-            get => InternalCalls.BoxCollider2DComponent_GetFriction(Entity.ID); 
-            set => InternalCalls.BoxCollider2DComponent_SetFriction(Entity.ID, value);
+            get => InternalCalls.BoxCollider2DComponent_GetFriction(ref Entity.Handle); 
+            set => InternalCalls.BoxCollider2DComponent_SetFriction(ref Entity.Handle, value);
         }
 
         public float Restitution
         {
-            get => InternalCalls.BoxCollider2DComponent_GetRestitution(Entity.ID); 
-            set => InternalCalls.BoxCollider2DComponent_SetRestitution(Entity.ID, value);
+            get => InternalCalls.BoxCollider2DComponent_GetRestitution(ref Entity.Handle); 
+            set => InternalCalls.BoxCollider2DComponent_SetRestitution(ref Entity.Handle, value);
         }
 
         public float RestitutionThreshold
         {
-            get => InternalCalls.BoxCollider2DComponent_GetThreshold(Entity.ID); 
-            set => InternalCalls.BoxCollider2DComponent_SetThreshold(Entity.ID, value);
+            get => InternalCalls.BoxCollider2DComponent_GetThreshold(ref Entity.Handle); 
+            set => InternalCalls.BoxCollider2DComponent_SetThreshold(ref Entity.Handle, value);
         }
 
         public Rigidbody2DComponent.Filters Mask
         {
             get
             {
-                return (Rigidbody2DComponent.Filters)InternalCalls.BoxCollider2DComponent_GetMask(Entity.ID);
+                return (Rigidbody2DComponent.Filters)InternalCalls.BoxCollider2DComponent_GetMask(ref Entity.Handle);
             }
             set
             {
-                InternalCalls.BoxCollider2DComponent_SetMask(Entity.ID, (short)value);
+                InternalCalls.BoxCollider2DComponent_SetMask(ref Entity.Handle, (short)value);
             }
         }
     }
@@ -395,56 +404,56 @@
     {
         public float Radius
         {
-            get => InternalCalls.CircleCollider2DComponent_GetRadius(Entity.ID); 
-            set => InternalCalls.CircleCollider2DComponent_SetRadius(Entity.ID, value);
+            get => InternalCalls.CircleCollider2DComponent_GetRadius(ref Entity.Handle); 
+            set => InternalCalls.CircleCollider2DComponent_SetRadius(ref Entity.Handle, value);
         }
 
         public Vector2 Offset
         {
             get
             {
-                InternalCalls.CircleCollider2DComponent_GetOffset(Entity.ID, out Vector2 offset);
+                InternalCalls.CircleCollider2DComponent_GetOffset(ref Entity.Handle, out Vector2 offset);
                 return offset;
             }
             set
             {
-                InternalCalls.CircleCollider2DComponent_SetOffset(Entity.ID, ref value);
+                InternalCalls.CircleCollider2DComponent_SetOffset(ref Entity.Handle, ref value);
             }
         }
 
         public float Density
         {
-            get => InternalCalls.CircleCollider2DComponent_GetDensity(Entity.ID); 
-            set => InternalCalls.CircleCollider2DComponent_SetDensity(Entity.ID, value);
+            get => InternalCalls.CircleCollider2DComponent_GetDensity(ref Entity.Handle); 
+            set => InternalCalls.CircleCollider2DComponent_SetDensity(ref Entity.Handle, value);
         }
 
         public float Friction
         {
-            get => InternalCalls.CircleCollider2DComponent_GetFriction(Entity.ID); 
-            set => InternalCalls.CircleCollider2DComponent_SetFriction(Entity.ID, value);
+            get => InternalCalls.CircleCollider2DComponent_GetFriction(ref Entity.Handle); 
+            set => InternalCalls.CircleCollider2DComponent_SetFriction(ref Entity.Handle, value);
         }
 
         public float Restitution
         {
-            get => InternalCalls.CircleCollider2DComponent_GetRestitution(Entity.ID); 
-            set => InternalCalls.CircleCollider2DComponent_SetRestitution(Entity.ID, value);
+            get => InternalCalls.CircleCollider2DComponent_GetRestitution(ref Entity.Handle); 
+            set => InternalCalls.CircleCollider2DComponent_SetRestitution(ref Entity.Handle, value);
         }
 
         public float RestitutionThreshold
         {
-            get => InternalCalls.CircleCollider2DComponent_GetThreshold(Entity.ID); 
-            set => InternalCalls.CircleCollider2DComponent_SetThreshold(Entity.ID, value);
+            get => InternalCalls.CircleCollider2DComponent_GetThreshold(ref Entity.Handle); 
+            set => InternalCalls.CircleCollider2DComponent_SetThreshold(ref Entity.Handle, value);
         }
 
         public Rigidbody2DComponent.Filters Mask
         {
             get
             {
-                return (Rigidbody2DComponent.Filters)InternalCalls.CircleCollider2DComponent_GetMask(Entity.ID);
+                return (Rigidbody2DComponent.Filters)InternalCalls.CircleCollider2DComponent_GetMask(ref Entity.Handle);
             }
             set
             {
-                InternalCalls.CircleCollider2DComponent_SetMask(Entity.ID, (short)value);
+                InternalCalls.CircleCollider2DComponent_SetMask(ref Entity.Handle, (short)value);
             }
         }
     }
@@ -1,28 +1,51 @@
 using System;
+using System.Runtime.InteropServices;
 
 namespace Nebula
 {
+    // Passed by ref to every entity internal call. The native side resolves the UUID once
+    // and caches the entt handle (index and generation) with the epoch of the scene it came from
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct EntityHandle
+    {
+        internal ulong ID;
+        internal uint Native;
+        internal uint Epoch;
+        // Spawn generation of pooled instances, a handle from an earlier spawn is rejected
+        internal uint Generation;
+
+        internal EntityHandle(ulong id)
+        {
+            ID = id;
+            Native = uint.MaxValue;
+            Epoch = 0;
+            Generation = 0;
+        }
+    }
+
     public class Entity
     {
-        protected Entity() { ID = 0; }
+        protected Entity() { ID = 0; Handle = new EntityHandle(0); }
 
         internal Entity(ulong id)
         {
             ID = id;
+            Handle = new EntityHandle(id);
         }
 
         public readonly ulong ID;
+        internal EntityHandle Handle;
 
         public Vector3 Translation
         {
             get
             {
-                InternalCalls.TransformComponent_GetTranslation(ID, out Vector3 translation);
+                InternalCalls.TransformComponent_GetTranslation(ref Handle, out Vector3 translation);
                 return translation;
             }
             set
             {
-                InternalCalls.TransformComponent_SetTranslation(ID, ref value);
+                InternalCalls.TransformComponent_SetTranslation(ref Handle, ref value);
             }
         }
 
@@ -30,12 +53,12 @@ namespace Nebula
         {
             get
             {
-                InternalCalls.TransformComponent_GetRotation(ID, out Vector3 rotation);
+                InternalCalls.TransformComponent_GetRotation(ref Handle, out Vector3 rotation);
                 return rotation;
             }
             set
             {
-                InternalCalls.TransformComponent_SetRotation(ID, ref value);
+                InternalCalls.TransformComponent_SetRotation(ref Handle, ref value);
             }
         }
 
@@ -43,12 +66,12 @@ namespace Nebula
         {
             get
             {
-                InternalCalls.TransformComponent_GetScale(ID, out Vector3 scale);
+                InternalCalls.TransformComponent_GetScale(ref Handle, out Vector3 scale);
                 return scale;
             }
             set
             {
-                InternalCalls.TransformComponent_SetScale(ID, ref value);
+                InternalCalls.TransformComponent_SetScale(ref Handle, ref value);
             }
         }
 
@@ -56,11 +79,11 @@ namespace Nebula
         {
             get
             {
-                return InternalCalls.Entity_GetName(ID);
+                return InternalCalls.Entity_GetName(ref Handle);
             }
             set
             {
-                InternalCalls.Entity_SetName(ID, value);
+                InternalCalls.Entity_SetName(ref Handle, value);
             }
         }
 
@@ -69,23 +92,23 @@ namespace Nebula
         {
             get
             {
-                return InternalCalls.Entity_GetLayer(ID);
+                return InternalCalls.Entity_GetLayer(ref Handle);
             }
             set
             {
-                InternalCalls.Entity_SetLayer(ID, value);
+                InternalCalls.Entity_SetLayer(ref Handle, value);
             }
         }
 
         public uint ChildCount
         {
-            get => InternalCalls.Entity_GetChildCount(ID);
+            get => InternalCalls.Entity_GetChildCount(ref Handle);
         }
 
         public bool HasComponent<T>() where T : Component, new()
         {
             Type componentType = typeof(T);
-            return InternalCalls.Entity_HasComponent(ID, componentType);
+            return InternalCalls.Entity_HasComponent(ref Handle, componentType);
         }
 
         public T GetComponent<T>() where T : Component, new()
@@ -100,7 +123,7 @@ namespace Nebula
         public T AddComponent<T>() where T : Component, new()
         {
             Type componentType = typeof(T);
-            InternalCalls.Entity_AddComponent(ID, componentType);
+            InternalCalls.Entity_AddComponent(ref Handle, componentType);
 
             T component = new T() { Entity = this };
             return component;
@@ -108,20 +131,20 @@ namespace Nebula
 
         public T As<T>() where T : Entity, new()
         {
-            object instance = InternalCalls.Entity_GetScriptInstance(ID);
+            object instance = InternalCalls.Entity_GetScriptInstance(ref Handle);
             return instance as T;
         }
 
         public T SetAs<T>() where T : Entity, new()
         {
             Type scriptType = typeof(T);
-            object instance = InternalCalls.Entity_SetScriptInstance(ID, scriptType);
+            object instance = InternalCalls.Entity_SetScriptInstance(ref Handle, scriptType);
             return instance as T;
         }
 
         public Entity FindChildByName(string name)
         {
-            ulong id = InternalCalls.Entity_FindChildByName(ID, name);
+            ulong id = InternalCalls.Entity_FindChildByName(ref Handle, name);
             if (id == 0)
                 return null;
 
@@ -130,7 +153,7 @@ namespace Nebula
         
         public Entity GetChildAtIndex(uint index)
         {
-            ulong id = InternalCalls.Entity_GetChild(ID, index);
+            ulong id = InternalCalls.Entity_GetChild(ref Handle, index);
             if (id == 0)
                 return null;
 
@@ -1,5 +1,25 @@
-﻿namespace Nebula
+﻿using System.Runtime.InteropServices;
+
+namespace Nebula
 {
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PrefabPoolStats
+    {
+        public uint Free;
+        public uint Active;
+        public ulong Hits;
+        public ulong Misses;
+
+        public float HitRate
+        {
+            get
+            {
+                ulong spawns = Hits + Misses;
+                return spawns > 0 ? (float)Hits / spawns : 0.0f;
+            }
+        }
+    }
+
     public class Prefab : Asset
     {
         protected Prefab()
@@ -26,6 +46,41 @@
             return new Entity(entityID);
         }
 
+        public Entity[] Instantiate(uint count)
+        {
+            ulong[] entityIDs = InternalCalls.Prefab_Instantiate(AssetHandle, count);
+
+            Entity[] entities = new Entity[entityIDs.Length];
+            for (int i = 0; i < entityIDs.Length; i++)
+                entities[i] = new Entity(entityIDs[i]);
+
+            return entities;
+        }
+
+        // Reuses an entity returned with Scene.DespawnEntity when there is one
+        public Entity Spawn()
+        {
+            ulong entityID = InternalCalls.Prefab_Spawn(AssetHandle);
+            if (entityID == 0)
+                return null;
+
+            return new Entity(entityID);
+        }
+
+        public void Prewarm(uint count)
+        {
+            InternalCalls.Prefab_Prewarm(AssetHandle, count);
+        }
+
+        public PrefabPoolStats PoolStats
+        {
+            get
+            {
+                InternalCalls.Prefab_GetPoolStats(AssetHandle, out PrefabPoolStats stats);
+                return stats;
+            }
+        }
+
         public static implicit operator string(Prefab prefab) => prefab.FilePath;
         public static implicit operator Prefab(string path) => new Prefab(path);
     }
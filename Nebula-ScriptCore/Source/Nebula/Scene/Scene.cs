@@ -19,13 +19,19 @@
 
         public static Entity DuplicateEntity(Entity entity)
         {
-            ulong entityID = InternalCalls.Scene_DuplicateEntity(entity.ID);
+            ulong entityID = InternalCalls.Scene_DuplicateEntity(ref entity.Handle);
             return new Entity(entityID);
         }
 
         public static void DestroyEntity(Entity entity)
         {
-            InternalCalls.Scene_DestroyEntity(entity.ID);
+            InternalCalls.Scene_DestroyEntity(ref entity.Handle);
+        }
+
+        // Returns an entity from Prefab.Spawn to its pool, anything else is destroyed
+        public static void DespawnEntity(Entity entity)
+        {
+            InternalCalls.Scene_DespawnEntity(ref entity.Handle);
         }
     }
 }
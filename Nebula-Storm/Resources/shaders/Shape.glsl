@@ -0,0 +1,146 @@
+#type vertex
+#version 450 core
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec2 localPosition;
+layout(location = 2) in vec4 colour;
+layout(location = 3) in vec2 texCoord;
+layout(location = 4) in float texIndex;
+layout(location = 5) in float tilingFactor;
+layout(location = 6) in float shape;
+layout(location = 7) in vec4 shapeParams;
+layout(location = 8) in int entityID;
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 u_ViewProjection;
+};
+
+struct VertexOutput
+{
+	vec2 LocalPosition;
+	vec4 Colour;
+	vec2 TexCoord;
+	float TilingFactor;
+	vec4 ShapeParams;
+};
+
+layout (location = 0) out VertexOutput Output;
+layout (location = 5) out flat float v_TexIndex;
+layout (location = 6) out flat float v_Shape;
+layout (location = 7) out flat int v_EntityID;
+			
+void main() {
+	Output.LocalPosition = localPosition;
+	Output.Colour = colour;
+	Output.TexCoord = texCoord;
+	Output.TilingFactor = tilingFactor;
+	Output.ShapeParams = shapeParams;
+	
+	v_TexIndex = texIndex;
+	v_Shape = shape;
+	v_EntityID = entityID;
+
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 colour;
+layout(location = 1) out int id;
+
+struct VertexOutput
+{
+	vec2 LocalPosition;
+	vec4 Colour;
+	vec2 TexCoord;
+	float TilingFactor;
+	vec4 ShapeParams;
+};
+
+layout (location = 0) in VertexOutput Input;
+layout (location = 5) in flat float v_TexIndex;
+layout (location = 6) in flat float v_Shape;
+layout (location = 7) in flat int v_EntityID;
+
+layout (binding = 0) uniform sampler2D u_Textures[32];
+
+// Must match Renderer2D::ShapeType
+#define SHAPE_QUAD			0
+#define SHAPE_CIRCLE		1
+#define SHAPE_ROUNDED_RECT	2
+
+float ShapeAlpha() {
+	int shape = int(v_Shape);
+	float fade = Input.ShapeParams.y;
+
+	// Rings are circles with a thickness below 1
+	if (shape == SHAPE_CIRCLE)
+	{
+		float thickness = Input.ShapeParams.x;
+		float distance = 1.0 - length(Input.LocalPosition);
+
+		float alpha = smoothstep(0.0, fade, distance);
+		return alpha * smoothstep(thickness + fade, thickness, distance);
+	}
+
+	if (shape == SHAPE_ROUNDED_RECT)
+	{
+		float radius = Input.ShapeParams.x;
+		vec2 halfSize = Input.ShapeParams.zw;
+
+		vec2 q = abs(Input.LocalPosition) - halfSize + radius;
+		float distance = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;
+		return 1.0 - smoothstep(-fade, 0.0, distance);
+	}
+
+	return 1.0;
+}
+
+void main() {
+	vec4 texColour = Input.Colour;
+	
+	switch(int(v_TexIndex))
+	{
+		case 0:  texColour *= texture(u_Textures[0],  Input.TexCoord * Input.TilingFactor); break;
+		case 1:  texColour *= texture(u_Textures[1],  Input.TexCoord * Input.TilingFactor); break;
+		case 2:  texColour *= texture(u_Textures[2],  Input.TexCoord * Input.TilingFactor); break;
+		case 3:  texColour *= texture(u_Textures[3],  Input.TexCoord * Input.TilingFactor); break;
+		case 4:  texColour *= texture(u_Textures[4],  Input.TexCoord * Input.TilingFactor); break;
+		case 5:  texColour *= texture(u_Textures[5],  Input.TexCoord * Input.TilingFactor); break;
+		case 6:  texColour *= texture(u_Textures[6],  Input.TexCoord * Input.TilingFactor); break;
+		case 7:  texColour *= texture(u_Textures[7],  Input.TexCoord * Input.TilingFactor); break;
+		case 8:  texColour *= texture(u_Textures[8],  Input.TexCoord * Input.TilingFactor); break;
+		case 9:  texColour *= texture(u_Textures[9],  Input.TexCoord * Input.TilingFactor); break;
+		case 10: texColour *= texture(u_Textures[10], Input.TexCoord * Input.TilingFactor); break;
+		case 11: texColour *= texture(u_Textures[11], Input.TexCoord * Input.TilingFactor); break;
+		case 12: texColour *= texture(u_Textures[12], Input.TexCoord * Input.TilingFactor); break;
+		case 13: texColour *= texture(u_Textures[13], Input.TexCoord * Input.TilingFactor); break;
+		case 14: texColour *= texture(u_Textures[14], Input.TexCoord * Input.TilingFactor); break;
+		case 15: texColour *= texture(u_Textures[15], Input.TexCoord * Input.TilingFactor); break;
+		case 16: texColour *= texture(u_Textures[16], Input.TexCoord * Input.TilingFactor); break;
+		case 17: texColour *= texture(u_Textures[17], Input.TexCoord * Input.TilingFactor); break;
+		case 18: texColour *= texture(u_Textures[18], Input.TexCoord * Input.TilingFactor); break;
+		case 19: texColour *= texture(u_Textures[19], Input.TexCoord * Input.TilingFactor); break;
+		case 20: texColour *= texture(u_Textures[20], Input.TexCoord * Input.TilingFactor); break;
+		case 21: texColour *= texture(u_Textures[21], Input.TexCoord * Input.TilingFactor); break;
+		case 22: texColour *= texture(u_Textures[22], Input.TexCoord * Input.TilingFactor); break;
+		case 23: texColour *= texture(u_Textures[23], Input.TexCoord * Input.TilingFactor); break;
+		case 24: texColour *= texture(u_Textures[24], Input.TexCoord * Input.TilingFactor); break;
+		case 25: texColour *= texture(u_Textures[25], Input.TexCoord * Input.TilingFactor); break;
+		case 26: texColour *= texture(u_Textures[26], Input.TexCoord * Input.TilingFactor); break;
+		case 27: texColour *= texture(u_Textures[27], Input.TexCoord * Input.TilingFactor); break;
+		case 28: texColour *= texture(u_Textures[28], Input.TexCoord * Input.TilingFactor); break;
+		case 29: texColour *= texture(u_Textures[29], Input.TexCoord * Input.TilingFactor); break;
+		case 30: texColour *= texture(u_Textures[30], Input.TexCoord * Input.TilingFactor); break;
+		case 31: texColour *= texture(u_Textures[31], Input.TexCoord * Input.TilingFactor); break;
+	}
+
+	texColour.a *= ShapeAlpha();
+	if (texColour.a == 0.0)
+		discard;
+
+	colour = texColour;
+	id = v_EntityID;
+}
\ No newline at end of file
@@ -9,6 +9,9 @@ namespace Nebula {
 		spec.Name = "Nebula Storm";
 		spec.CommandLineArgs = args;
 
+		if (args.Count > 1)
+			spec.ProjectPath = args[1];
+
 		Application* app = new Application(spec);
 		app->PushLayer(new EditorLayer());
 
@@ -111,11 +111,10 @@ namespace Nebula {
 		//Create New Scene
 		NewScene();
 
-		//Open Project on Startup
+		//Project is loaded by the application on startup
 #if true
-		auto commandLineArgs = Application::Get().GetSpecification().CommandLineArgs;
-		if (commandLineArgs.Count > 1)
-			OpenProject(commandLineArgs[1]);
+		if (Project::GetActive())
+			OnProjectOpened();
 #else
 		OpenProject();
 #endif
@@ -147,10 +146,22 @@ namespace Nebula {
 		glm::vec2 viewportSize = m_ViewPortBounds[1] - m_ViewPortBounds[0];
 		my = viewportSize.y - my;
 
-		if (mx >= 0 && my >= 0 && mx < viewportSize.x && my < viewportSize.y) {
-			int pixelData = frameBuffer->ReadPixel(1, (int)mx, (int)my);
-			m_HoveredEntity = pixelData == -1 ? Entity() : Entity((entt::entity)pixelData, m_ActiveScene.get());
+		if (mx < 0 || my < 0 || mx >= viewportSize.x || my >= viewportSize.y)
+			return;
+
+		if (m_GPUPicking) {
+			frameBuffer->RequestPixel(1, (int)mx, (int)my);
+
+			// The pixel was rendered a frame ago, the entity may have been destroyed since.
+			// The ID includes the entt version, so a recycled handle fails the check as well
+			int pixelData = frameBuffer->GetRequestedPixel();
+			Entity hovered = { (entt::entity)pixelData, m_ActiveScene.get() };
+			m_HoveredEntity = pixelData != -1 && hovered.IsValid() ? hovered : Entity();
+			return;
 		}
+
+		glm::vec2 ndc = { mx / viewportSize.x * 2.0f - 1.0f, my / viewportSize.y * 2.0f - 1.0f };
+		m_HoveredEntity = m_ActiveScene->PickEntity(m_EditorCam.GetViewProjection(), ndc);
 	}
 	
 	void EditorLayer::Update(Timestep ts) {
@@ -196,6 +207,8 @@ namespace Nebula {
 	void EditorLayer::Render() {
 		NB_PROFILE_FUNCTION();
 
+		Renderer2D::ResetStats();
+
 		frameBuffer->Bind();
 		RenderCommand::Clear();
 
@@ -271,6 +284,37 @@ namespace Nebula {
 			ImGui::Text("Total Frames: %i", m_TotalFrames);
 			ImGui::Text("Average FPS: %.1f", m_TotalFrames / (Time::Elapsed() - m_TimeSinceReset));
 
+			Renderer2D::Statistics renderStats = Renderer2D::GetStats();
+			ImGui::Text("");
+			ImGui::Text("Draw Calls: %u", renderStats.DrawCalls);
+			ImGui::Text("Quads: %u, Circles: %u, Triangles: %u", renderStats.QuadCount, renderStats.CircleCount, renderStats.TriangleCount);
+			ImGui::Text("Lines: %u, Characters: %u", renderStats.LineCount, renderStats.CharacterCount);
+
+			FrameBufferPoolStats poolStats = FrameBuffer::GetPoolStats();
+			ImGui::Text("");
+			ImGui::Text("Render Target Pool Hits: %u, Misses: %u", poolStats.Hits, poolStats.Misses);
+			ImGui::Text("Render Targets: %u (%.2f MB)", poolStats.TexturesAllocated, poolStats.BytesAllocated / (1024.0f * 1024.0f));
+
+			const SystemTimeline& timeline = m_ActiveScene->GetSystemTimeline();
+			ImGui::Text("");
+			ImGui::Text("Systems: %.3fms", timeline.Duration);
+			for (const SystemTiming& system : timeline.Systems)
+				ImGui::Text("  %s: thread %u, %.3fms + %.3fms", system.Name.c_str(), system.Thread, system.Start, system.Duration);
+
+			for (uint32_t thread = 0; thread < timeline.Utilisation.size(); thread++)
+				ImGui::Text("  Thread %u: %.1f%%", thread, timeline.Utilisation[thread] * 100.0f);
+
+			ImGui::Text("");
+			if (ImGui::TreeNode("Scene Memory"))
+			{
+				SceneMemoryReport memory = m_ActiveScene->GetMemoryReport();
+				ImGui::Text("Entities: %u, %.2f KB", (uint32_t)memory.EntityCount, memory.TotalBytes / 1024.0f);
+				for (const SceneMemoryReport::Storage& storage : memory.Storages)
+					ImGui::Text("  %s: %u, %.2f KB", storage.Name.c_str(), (uint32_t)storage.Count, storage.Bytes / 1024.0f);
+
+				ImGui::TreePop();
+			}
+
 			ImGui::SetCursorPosX(ImGui::GetContentRegionAvailWidth() / 2.0f);
 			if (ImGui::Button("Reset")) {
 				m_TotalFrames = m_LastFrame;
@@ -315,6 +359,9 @@ namespace Nebula {
 				if (ImGui::MenuItem("Show Grid", NULL, m_ShowGrid))
 					m_ShowGrid = !m_ShowGrid;
 
+				if (ImGui::MenuItem("GPU Mouse Picking", NULL, m_GPUPicking))
+					m_GPUPicking = !m_GPUPicking;
+
 				if (ImGui::BeginMenu("Style"))
 				{
 					if (ImGui::Button("Dark", ImVec2{ 100.0f, 0.0f }))
@@ -369,7 +416,7 @@ namespace Nebula {
 
 			const CameraComponent& cc = camera.GetComponent<CameraComponent>();
 			const WorldTransformComponent& wtc = camera.GetComponent<WorldTransformComponent>();
-			Renderer2D::BeginScene(cc.Camera, wtc.Transform);
+			Renderer2D::BeginScene(cc.Camera, wtc.Transform.ToMat4());
 		}
 		else 
 		{
@@ -403,12 +450,9 @@ namespace Nebula {
 		for (auto entity : CircleView) {
 			auto [wtc, cc] = CircleView.get<WorldTransformComponent, CircleColliderComponent>(entity);
 
-			glm::vec3 wTranslation, wRotation, wScale;
-			Maths::DecomposeTransform(wtc.Transform, wTranslation, wRotation, wScale);
+			glm::vec3 Scale = wtc.Scale.x * glm::vec3(cc.Radius * 2.0f);
 
-			glm::vec3 Scale = wScale.x * glm::vec3(cc.Radius * 2.0f);
-
-			glm::mat4 transform = glm::translate(wTranslation) * glm::toMat4(glm::quat(wRotation))
+			glm::mat4 transform = glm::translate(wtc.GetTranslation()) * glm::rotate(wtc.Rotation, glm::vec3(0.0f, 0.0f, 1.0f))
 				* glm::translate(glm::vec3(cc.Offset, -projectionCollider.z)) * glm::scale(Scale);
 			Renderer2D::DrawCircle(transform, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f), 0.05f);
 		}
@@ -417,12 +461,9 @@ namespace Nebula {
 		for (auto entity : BoxView) {
 			auto [wtc, bc2d] = BoxView.get<WorldTransformComponent, BoxCollider2DComponent>(entity);
 
-			glm::vec3 wTranslation, wRotation, wScale;
-			Maths::DecomposeTransform(wtc.Transform, wTranslation, wRotation, wScale);
-
-			glm::vec3 Scale = wScale * glm::vec3(bc2d.Size, 0.0f) * 2.0f;
+			glm::vec3 Scale = glm::vec3(wtc.Scale * bc2d.Size, 0.0f) * 2.0f;
 
-			glm::mat4 transform = glm::translate(wTranslation) * glm::toMat4(glm::quat(wRotation)) *
+			glm::mat4 transform = glm::translate(wtc.GetTranslation()) * glm::rotate(wtc.Rotation, glm::vec3(0.0f, 0.0f, 1.0f)) *
 				glm::translate(glm::vec3(bc2d.Offset, zIndex)) * glm::scale(Scale);
 			Renderer2D::Draw(NB_RECT, transform, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
 		}
@@ -437,14 +478,11 @@ namespace Nebula {
 			|| selectedEntity.HasComponent<CircleRendererComponent>())
 		{
 			const WorldTransformComponent& wtc = selectedEntity.GetComponent<WorldTransformComponent>();
-			Renderer2D::Draw(NB_RECT, wtc.Transform, glm::vec4(1.0f, 0.5f, 0.0f, 1.0f));
+			Renderer2D::Draw(NB_RECT, wtc.Transform.ToMat4(), glm::vec4(1.0f, 0.5f, 0.0f, 1.0f));
 		}
 		
-		for (auto& id : selectedEntity.GetParentChild().ChildrenIDs)
-		{
-			Entity child = { id, selectedEntity };
+		for (Entity child = selectedEntity.GetFirstChild(); child; child = child.GetNextSibling())
 			RenderSelectionUI(child);
-		}
 	}
 
 	void EditorLayer::UI_GameView() {
@@ -464,7 +502,8 @@ namespace Nebula {
 		m_GameViewSize = { panelSize.x, panelSize.y };
 
 		uint64_t textureID = frameBuffer->GetColourAttachmentRendererID();
-		ImGui::Image((void*)textureID, panelSize, ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+		glm::vec2 uv = frameBuffer->GetAttachmentUV();
+		ImGui::Image((void*)textureID, panelSize, ImVec2{ 0, uv.y }, ImVec2{ uv.x, 0 });
 
 		if (ImGui::BeginDragDropTarget()) 
 		{
@@ -497,7 +536,13 @@ namespace Nebula {
 			Entity selectedEntity = m_SceneHierarchy.GetSelectedEntity();
 			if (selectedEntity && m_GizmoType != -1) 
 			{
-				auto& wc = selectedEntity.GetComponent<WorldTransformComponent>();
+				// The world transform is flattened to 2D, so rebuild the full matrix from the local one
+				auto& tc = selectedEntity.GetComponent<TransformComponent>();
+				glm::mat4 parentTransform = glm::mat4(1.0f);
+				if (Entity parent = selectedEntity.GetParent())
+					parentTransform = parent.GetWorldTransform().Transform.ToMat4();
+
+				glm::mat4 worldTransform = parentTransform * tc.CalculateMatrix();
 				
 				bool snap = Input::IsKeyPressed(Key::LeftControl);
 				float snapValue = 0.25f;
@@ -507,23 +552,14 @@ namespace Nebula {
 				float snapValues[3] = { snapValue, snapValue, snapValue };
 
 				ImGuizmo::Manipulate(value_ptr(cameraView), value_ptr(cameraProj),
-					(ImGuizmo::OPERATION)m_GizmoType, ImGuizmo::LOCAL, value_ptr(wc.Transform), nullptr, snap ? snapValues : nullptr);
+					(ImGuizmo::OPERATION)m_GizmoType, ImGuizmo::LOCAL, value_ptr(worldTransform), nullptr, snap ? snapValues : nullptr);
 
 				if (ImGuizmo::IsUsing()) 
 				{
-					glm::mat4 transform = wc.Transform;
-					
-					if (UUID pid = selectedEntity.GetParentChild().Parent)
-					{
-						Entity parent = { pid, m_ActiveScene.get() };
-						auto& pwc = parent.GetComponent<WorldTransformComponent>();
-						transform = glm::inverse(pwc.Transform) * wc.Transform;
-					}
-					
-					auto& tc = selectedEntity.GetComponent<TransformComponent>();
+					glm::mat4 transform = glm::inverse(parentTransform) * worldTransform;
 					Maths::DecomposeTransform(transform, tc.Translation, tc.Rotation, tc.Scale);
 
-					selectedEntity.UpdateTransform();
+					selectedEntity.MarkTransformDirty();
 				}
 			}
 		}
@@ -733,13 +769,18 @@ namespace Nebula {
 		if (Project::Load(path))
 		{
 			ScriptEngine::ReloadAssembly();
-			m_ContentBrowser.SetContext(Project::GetAssetDirectory());
-			
-			std::filesystem::path startScenePath = Project::GetAssetFileSystemPath(Project::GetActive()->GetConfig().StartScene);
-			LoadScene(startScenePath);
+			OnProjectOpened();
 		}
 	}
 
+	void EditorLayer::OnProjectOpened()
+	{
+		m_ContentBrowser.SetContext(Project::GetAssetDirectory());
+			
+		std::filesystem::path startScenePath = Project::GetAssetFileSystemPath(Project::GetActive()->GetConfig().StartScene);
+		LoadScene(startScenePath);
+	}
+
 	void EditorLayer::NewScene() {
 		if (m_SceneState != SceneState::Edit)
 			OnSceneStop();
@@ -796,6 +837,17 @@ namespace Nebula {
 
 		Ref<Scene> empty = CreateRef<Scene>();
 		if (SceneSerializer(empty).Deserialize(path.string())) {
+			// Textures and fonts load together now, rather than one by one as the first frame draws them
+			Array<AssetHandle> assets;
+			auto spriteView = empty->GetAllEntitiesWith<SpriteRendererComponent>();
+			for (auto entity : spriteView)
+				assets.push_back(spriteView.get<SpriteRendererComponent>(entity).Texture);
+
+			auto stringView = empty->GetAllEntitiesWith<StringRendererComponent>();
+			for (auto entity : stringView)
+				assets.push_back(stringView.get<StringRendererComponent>(entity).FontHandle);
+			AssetManager::LoadAssets(assets);
+
 			m_EditorScene = empty;
 			m_ActiveScene->OnViewportResize((uint32_t)m_GameViewSize.x, (uint32_t)m_GameViewSize.y);
 			m_SceneHierarchy.SetContext(m_EditorScene);
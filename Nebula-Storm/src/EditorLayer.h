@@ -36,6 +36,7 @@ namespace Nebula {
 		void SaveProject();
 		void OpenProject();
 		void OpenProject(const std::filesystem::path& path);
+		void OnProjectOpened();
 		
 		void NewScene();
 		void SaveScene();
@@ -59,6 +60,7 @@ namespace Nebula {
 		bool m_UsingGizmo = false;
 		bool m_ShowColliders = false;
 		bool m_ShowGrid = false;
+		bool m_GPUPicking = false;
 
 		bool m_ShowDebug = false;
 		uint32_t m_Frames = 0;
@@ -17,48 +17,34 @@ namespace Nebula {
 	static float s_MaxItemWidth		= 425.0f;
 
 	struct RectData {
-		UUID Parent;
+		Entity Parent;
+		Entity After; // Dropped entities go after this one, or first if null
 		ImRect Rect;
-		uint32_t indexAbove;
-		uint32_t indexBelow;
 	};
 
 	static bool DroppedIntoChildren(Entity child, Entity parentEntity) {
 		if (parentEntity.GetUUID() == child.GetUUID())
 			return true;
 
-		UUID parent = parentEntity.GetParentChild().Parent;
+		Entity parent = parentEntity.GetParent();
 		if (!parent)
 			return false;
 
-		return DroppedIntoChildren(child, Entity(parent, parentEntity));
+		return DroppedIntoChildren(child, parent);
 	}
 
 	static void AddParent(UUID childID, Entity parentEntity, Scene* scene) {
-		auto& parent = parentEntity.GetComponent<ParentChildComponent>();
-
 		Entity dropEnt{ childID, scene };
-		auto& child = dropEnt.GetComponent<ParentChildComponent>();
 
 		//Check if Dropped Entity is being dropped to parent of itself
-		if (child.Parent == parentEntity.GetUUID())
+		if (dropEnt.GetParent() == parentEntity)
 			return;
 
 		if (DroppedIntoChildren(dropEnt, parentEntity))
 			return;
 
 		//Go Ahead if safe
-		UUID parentID = child.Parent;
-		if (parentID) {
-			Entity parent{ parentID, scene };
-			parent.GetParentChild().RemoveChild(childID);
-		}
-
-		parent.AddChild(childID);
-		scene->m_SceneOrder.remove(childID);
-		
-		child.Parent = parentEntity.GetUUID();
-		parentEntity.UpdateTransform();
+		scene->SetParent(dropEnt, parentEntity);
 	}
 	
 	static void EntityPayload(Scene* currentScene) {
@@ -67,18 +53,12 @@ namespace Nebula {
 			return;
 	
 		Entity Ent{ *(const UUID*)payload->Data, currentScene };
-		auto& ParentComp = Ent.GetParentChild();
+		Entity parent = Ent.GetParent();
 
-		if (!ParentComp.Parent)
+		if (!parent)
 			return;
 
-		Entity{ ParentComp.Parent, currentScene }.GetComponent<ParentChildComponent>().RemoveChild(*(const UUID*)payload->Data);
-
-		UUID parentsParent = Entity{ ParentComp.Parent, currentScene }.GetParentChild().Parent;
-		ParentComp.Parent = parentsParent;
-
-		if (parentsParent)
-			Entity{ parentsParent, currentScene }.GetParentChild().AddChild(Ent.GetUUID());
+		currentScene->SetParent(Ent, parent.GetParent());
 	}
 
 	static bool DrawVec2Control(const std::string& label, glm::vec2& values, const glm::vec2& min = glm::vec2(0.0f), const glm::vec2& max = glm::vec2(0.0f),
@@ -165,7 +145,7 @@ namespace Nebula {
 		if (!m_Context)
 			return;
 		
-		DrawArray(m_Context->m_SceneOrder);
+		DrawSiblings({}, m_Context->GetFirstRoot());
 
 		for (uint32_t i = 0; i < Rects.size(); i++) {
 			RectData* data = Rects[i];
@@ -174,50 +154,16 @@ namespace Nebula {
 			if (ImGui::BeginDragDropTargetCustom(data->Rect, 1)) {
 				if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload("ENTITY")) {
 					const UUID entityID = *(const UUID*)payload->Data;
+					Entity entity = { entityID, m_Context.get() };
 					
-					if (data->Parent) {
-						Entity parent = { data->Parent, m_Context.get() };
-						AddParent(entityID, parent, m_Context.get());
-						
-						Array<UUID>& children = parent.GetParentChild().ChildrenIDs;
-
-						size_t entityIndex = children.find(entityID);
-						size_t newIndex = entityIndex;
-
-						if (entityIndex > data->indexBelow)
-							newIndex = data->indexBelow;
-
-						if (entityIndex < data->indexAbove)
-							newIndex = data->indexAbove;
-						
-						children.move(entityIndex, newIndex);
-					} 
-					else 
-					{
-						Entity entity = { entityID, m_Context.get() };
-						
-						if (UUID parentID = entity.GetParentChild().Parent)
-						{
-							Entity parent = { parentID, m_Context.get() };
-							parent.GetParentChild().RemoveChild(entityID);
-							
-							entity.GetParentChild().Parent = NULL;
-							m_Context->m_SceneOrder.push_back(entityID);
-							
-							entity.UpdateTransform();
-						}
-						
-						size_t entityIndex = m_Context->m_SceneOrder.find(entityID);
-						size_t newIndex = entityIndex;
-
-						if (entityIndex > data->indexBelow)
-							newIndex = data->indexBelow;
-
-						if (entityIndex < data->indexAbove)
-							newIndex = data->indexAbove;
+					if (data->Parent)
+						AddParent(entityID, data->Parent, m_Context.get());
+					else
+						m_Context->SetParent(entity, {});
 
-						m_Context->m_SceneOrder.move(entityIndex, newIndex);
-					}
+					// AddParent refuses to drop an entity into its own children
+					if (entity.GetParentChild().Parent == (entt::entity)data->Parent)
+						m_Context->MoveAfter(entity, data->After);
 				}
 				ImGui::EndDragDropTarget();
 			}
@@ -285,36 +231,44 @@ namespace Nebula {
 		}
 	}
 
-	void SceneHierarchyPanel::DrawArray(Array<UUID>& entities) {
-		if (entities.size()) {
-			Entity entity{ entities[0], m_Context.get() };
-			ImVec2 cursorPos = ImGui::GetCursorPos();
-			ImVec2 elementSize = ImGui::GetItemRectSize();
-			elementSize.x -= ImGui::GetStyle().FramePadding.x;
-			elementSize.y = ImGui::GetStyle().FramePadding.y;
-			cursorPos.y -= ImGui::GetStyle().FramePadding.y;
-			ImVec2 windowPos = ImGui::GetCurrentWindow()->Pos;
-			RectData* data = new RectData();
-			data->Parent = entity.GetParentChild().Parent;
-			data->Rect = ImRect(windowPos.x + cursorPos.x, windowPos.y + cursorPos.y, windowPos.x + cursorPos.x + elementSize.x, windowPos.y + cursorPos.y + elementSize.y);
-			data->indexAbove = 0;
-			data->indexBelow = 0;
-			Rects.push_back(data);
-		}
-		
-		for (uint32_t n = 0; n < entities.size(); n++) {
-			Entity entity{ entities[n], m_Context.get() };
-			DrawEntityNode(entity, n);
+	void SceneHierarchyPanel::DrawSiblings(Entity parent, Entity first) {
+		if (first)
+			AddDropRect(parent, {}, false);
+
+		uint32_t index = 0;
+		for (Entity child = first; child; index++) {
+			// The child can be deleted from its context menu
+			Entity next = child.GetNextSibling();
+			DrawEntityNode(child, index);
+			child = next;
 		}
 	}
 
+	void SceneHierarchyPanel::AddDropRect(Entity parent, Entity after, bool fullWidth) {
+		ImVec2 cursorPos = ImGui::GetCursorPos();
+		ImVec2 elementSize = ImGui::GetItemRectSize();
+		elementSize.x -= ImGui::GetStyle().FramePadding.x;
+		elementSize.y = ImGui::GetStyle().FramePadding.y;
+		cursorPos.y -= ImGui::GetStyle().FramePadding.y;
+		ImVec2 windowPos = ImGui::GetCurrentWindow()->Pos;
+
+		if (fullWidth)
+			elementSize.x = ImGui::GetContentRegionAvailWidth();
+
+		RectData* data = new RectData();
+		data->Parent = parent;
+		data->After = after;
+		data->Rect = ImRect(windowPos.x + cursorPos.x, windowPos.y + cursorPos.y, windowPos.x + cursorPos.x + elementSize.x, windowPos.y + cursorPos.y + elementSize.y);
+		Rects.push_back(data);
+	}
+
 	void SceneHierarchyPanel::DrawEntityNode(Entity entity, uint32_t index) {
-		auto& tag = entity.GetComponent<TagComponent>().Tag;
+		const std::string& tag = entity.GetName();
 
 		ImGuiTreeNodeFlags flags = m_SelectionContext == entity ? ImGuiTreeNodeFlags_Selected : ImGuiTreeNodeFlags_None;
 		flags |= ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_FramePadding;
 
-		if (entity.GetParentChild().ChildrenIDs.size() == 0)
+		if (entity.GetChildCount() == 0)
 			flags |= ImGuiTreeNodeFlags_Leaf;
 
 		bool opened = ImGui::TreeNodeEx((void*)(uint32_t)entity, flags, tag.c_str());
@@ -350,11 +304,7 @@ namespace Nebula {
 		}
 
 		if (opened) {
-			if (entity.HasComponent<ParentChildComponent>()) {
-				auto& comp = entity.GetParentChild();
-				DrawArray(comp.ChildrenIDs);
-			}
-
+			DrawSiblings(entity, entity.GetFirstChild());
 			ImGui::TreePop();
 		}
 		
@@ -365,23 +315,7 @@ namespace Nebula {
 			return;
 		}
 
-		ImVec2 cursorPos = ImGui::GetCursorPos();
-		ImVec2 elementSize = ImGui::GetItemRectSize();
-		elementSize.x -= ImGui::GetStyle().FramePadding.x;
-		elementSize.y = ImGui::GetStyle().FramePadding.y;
-		cursorPos.y -= ImGui::GetStyle().FramePadding.y;
-		ImVec2 windowPos = ImGui::GetCurrentWindow()->Pos;
-		RectData* data = new RectData();
-		data->Parent = entity.GetParentChild().Parent;
-
-		if (index == 0)
-			elementSize.x = ImGui::GetContentRegionAvailWidth();
-
-		data->Rect = ImRect(windowPos.x + cursorPos.x, windowPos.y + cursorPos.y, windowPos.x + cursorPos.x + elementSize.x, windowPos.y + cursorPos.y + elementSize.y);
-		data->indexAbove = index;
-		data->indexBelow = index + 1;
-
-		Rects.push_back(data);
+		AddDropRect(entity.GetParent(), entity, index == 0);
 	}
 
 	static float DrawLabel(std::string label) 
@@ -667,7 +601,17 @@ namespace Nebula {
 				float indentation = ImGui::GetTreeNodeToLabelSpacing() - (style.FramePadding.x + style.ItemSpacing.x);
 				ImGui::Unindent(indentation);
 				
+				// The group is active while any of its widgets, popups included, is being edited
+				ImGui::BeginGroup();
 				function(component);
+				ImGui::EndGroup();
+
+				if constexpr (IsTrackedComponent<T>)
+				{
+					if (ImGui::IsItemActive() || ImGui::IsItemDeactivated())
+						entity.MarkDirty<T>();
+				}
+
 				ImGui::Separator();
 				
 				ImGui::Indent(indentation);
@@ -701,12 +645,9 @@ namespace Nebula {
 				body->SetEnabled(enabled);
 		}
 		
-		auto& pcc = entity.GetParentChild();
-		for (UUID id : pcc.ChildrenIDs)
+		for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
 		{
-			Entity child = { id, entity };
-			auto& prop = child.GetComponent<PropertiesComponent>();
-			prop.Enabled = enabled;
+			child.SetEnabled(enabled);
 			UpdateChildProperties(child, enabled);
 		}
 	}
@@ -715,7 +656,7 @@ namespace Nebula {
 		float buttonWidth = ImGui::CalcTextSize("Add Component").x + GImGui->Style.ItemSpacing.x * 2;
 
 		if (entity.HasComponent<TagComponent>()) {
-			auto& tag = entity.GetComponent<TagComponent>().Tag;
+			const std::string& tag = entity.GetName();
 
 			char buffer[256];
 			strncpy_s(buffer, sizeof(buffer), tag.c_str(), sizeof(buffer));
@@ -723,7 +664,7 @@ namespace Nebula {
 			ImGui::SetNextItemWidth(ImGui::GetContentRegionAvailWidth() - buttonWidth - GImGui->Style.ItemSpacing.x);
 
 			if (ImGui::InputText("##Tag", buffer, sizeof(buffer))) {
-				tag = std::string(buffer);
+				entity.SetName(buffer);
 			}
 		}
 
@@ -737,16 +678,20 @@ namespace Nebula {
 			auto& prop = entity.GetComponent<PropertiesComponent>();
 
 			ImGui::SetNextItemWidth(ImGui::GetContentRegionAvailWidth() - 25.0f - GImGui->Style.ItemSpacing.x);
-			if (ImGui::BeginCombo("##V", prop.Layer->Name.c_str()))
-			{
-				const ProjectConfig& pConfig = Project::GetActive()->GetConfig();
+			const ProjectConfig& pConfig = Project::GetActive()->GetConfig();
+			auto current = pConfig.Layers.find(prop.Layer);
 
+			if (ImGui::BeginCombo("##V", current != pConfig.Layers.end() ? current->second->Name.c_str() : "None"))
+			{
 				for (auto [l, layer] : pConfig.Layers)
 				{
-					bool isSelected = prop.Layer == layer;
+					bool isSelected = prop.Layer == l;
 					
 					if (ImGui::Selectable(layer->Name.c_str(), isSelected))
-						prop.Layer = pConfig.Layers.at(l);
+					{
+						prop.Layer = l;
+						entity.MarkDirty<PropertiesComponent>();
+					}
 					
 					if (isSelected)
 						ImGui::SetItemDefaultFocus();
@@ -757,8 +702,12 @@ namespace Nebula {
 
 			ImGui::SameLine();
 
-			if (ImGui::Checkbox("##Enabled", &prop.Enabled))
-				UpdateChildProperties(entity, prop.Enabled);
+			bool enabled = prop.Enabled;
+			if (ImGui::Checkbox("##Enabled", &enabled))
+			{
+				entity.SetEnabled(enabled);
+				UpdateChildProperties(entity, enabled);
+			}
 		}
 
 		if (ImGui::BeginPopup("Add Component")) {
@@ -792,7 +741,7 @@ namespace Nebula {
 			component.Scale = scale;
 
 			if (p || r || s)
-				entity.UpdateTransform();
+				entity.MarkTransformDirty();
 		});
 
 		DrawComponent<CameraComponent>("Camera", entity, [](auto& component) mutable {
@@ -849,8 +798,12 @@ namespace Nebula {
 			bool classExists = ScriptEngine::EntityClassExists(component.ClassName);
 			UI::ScopedStyleColor colour(ImGuiCol_Text, ImVec4(0.9f, 0.2f, 0.3f, 1.0f), !classExists);
 			
-			if (DrawTextBox("Class", component.ClassName))
+			std::string className = component.ClassName.GetString();
+			if (DrawTextBox("Class", className))
+			{
+				component.ClassName = className;
 				ScriptEngine::CreateScriptInstance(entity);
+			}
 			
 			// FIELDS
 			if (Ref<ScriptInstance> scriptInstance = ScriptEngine::GetScriptInstance(entity))
@@ -865,25 +818,25 @@ namespace Nebula {
 					{
 					case Nebula::ScriptFieldType::Float:
 					{
-						auto data = scriptInstance->GetFieldValue<float>(name);
+						auto data = scriptInstance->GetFieldValue<float>(field.Name);
 						if (DrawVec1Control(name.c_str(), data))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						break;
 					}
 					case Nebula::ScriptFieldType::Bool:
 					{
-						auto data = scriptInstance->GetFieldValue<bool>(name);
+						auto data = scriptInstance->GetFieldValue<bool>(field.Name);
 						if (DrawBool(name.c_str(), data))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						break;
 					}
 					case Nebula::ScriptFieldType::Int:
 					{
-						auto data = scriptInstance->GetFieldValue<int>(name);
+						auto data = scriptInstance->GetFieldValue<int>(field.Name);
 						
 						ImGui::PushID(name.c_str());
 						float size = DrawLabel(name);
@@ -891,41 +844,41 @@ namespace Nebula {
 
 						if (ImGui::DragInt("##V", &data))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						ImGui::PopID();
 						break;
 					}
 					case Nebula::ScriptFieldType::Vector2:
 					{
-						auto data = scriptInstance->GetFieldValue<glm::vec2>(name);
+						auto data = scriptInstance->GetFieldValue<glm::vec2>(field.Name);
 						if (DrawVec2Control(name.c_str(), data))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						break;
 					}
 					case Nebula::ScriptFieldType::Vector3:
 					{
-						auto data = scriptInstance->GetFieldValue<glm::vec3>(name);
+						auto data = scriptInstance->GetFieldValue<glm::vec3>(field.Name);
 						if (DrawVec3Control(name.c_str(), data))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						break;
 					}
 					case Nebula::ScriptFieldType::Vector4:
 					{
-						auto data = scriptInstance->GetFieldValue<glm::vec4>(name);
+						auto data = scriptInstance->GetFieldValue<glm::vec4>(field.Name);
 						if (ImGui::DragFloat4(name.c_str(), value_ptr(data)))
 						{
-							scriptInstance->SetFieldValue(name, data);
+							scriptInstance->SetFieldValue(field.Name, data);
 						}
 						break;
 					}
 					case Nebula::ScriptFieldType::Entity:
 					{
-						auto data = scriptInstance->GetFieldValue<MonoObject*>(name);
+						auto data = scriptInstance->GetFieldValue<MonoObject*>(field.Name);
 						UUID id = ScriptEngine::GetIDFromObject(data);
 						std::string text = "None";
 						
@@ -938,7 +891,7 @@ namespace Nebula {
 						
 						DrawLabel(name);
 						if (ImGui::Button(text.c_str(), ImVec2{ ImGui::GetContentRegionAvailWidth(), 0 }))
-							scriptInstance->SetFieldValueInternal(name, nullptr);
+							scriptInstance->SetFieldValueInternal(field.Name, nullptr);
 
 						if (ImGui::BeginDragDropTarget())
 						{
@@ -946,7 +899,7 @@ namespace Nebula {
 							{
 								const UUID payloadID = *(const UUID*)payload->Data;
 								MonoObject* object = ScriptEngine::CreateEntityClass(payloadID);
-								scriptInstance->SetFieldValueInternal(name, object);
+								scriptInstance->SetFieldValueInternal(field.Name, object);
 							}
 						}
 
@@ -957,7 +910,7 @@ namespace Nebula {
 					case ScriptFieldType::Texture:
 					case ScriptFieldType::Asset:
 					{
-						auto data = scriptInstance->GetFieldValue<MonoObject*>(name);
+						auto data = scriptInstance->GetFieldValue<MonoObject*>(field.Name);
 						AssetHandle handle = ScriptEngine::GetIDFromObject(data);
 						const AssetMetadata& metadata = AssetManager::GetAssetMetadata(handle);
 						
@@ -967,7 +920,7 @@ namespace Nebula {
 						
 						DrawLabel(name);
 						if (ImGui::Button(text.c_str(), ImVec2{ ImGui::GetContentRegionAvailWidth(), 0 }))
-							scriptInstance->SetFieldValueInternal(name, nullptr);
+							scriptInstance->SetFieldValueInternal(field.Name, nullptr);
 
 						if (ImGui::BeginDragDropTarget()) 
 						{
@@ -978,7 +931,7 @@ namespace Nebula {
 
 								AssetHandle handle = AssetManager::CreateAsset(path);
 								MonoObject* object = ScriptEngine::CreateAssetClass(handle);
-								scriptInstance->SetFieldValueInternal(name, object);
+								scriptInstance->SetFieldValueInternal(field.Name, object);
 							}
 						}
 						
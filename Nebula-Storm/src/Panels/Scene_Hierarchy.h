@@ -27,7 +27,8 @@ namespace Nebula {
 		void DisplayAddComponentEntry(const std::string& entryName);
 
 		void DrawEntityNode(Entity entity, uint32_t index);
-		void DrawArray(Array<UUID>& entities);
+		void DrawSiblings(Entity parent, Entity first);
+		void AddDropRect(Entity parent, Entity after, bool fullWidth);
 		void DrawComponents(Entity entity);
 	private:
 		Ref<Scene> m_Context;
@@ -51,6 +51,12 @@ namespace Nebula
 			return std::static_pointer_cast<T>(asset);
 		}
 
+		static inline void LoadAssets(const Array<AssetHandle>& handles)
+		{
+			NB_ASSERT(Project::GetAssetManager());
+			Project::GetAssetManager()->LoadAssets(handles);
+		}
+
 		static inline const AssetMetadata& GetAssetMetadata(AssetHandle handle)
 		{
 			NB_ASSERT(Project::GetAssetManager());
@@ -2,9 +2,12 @@
 #include "AssetManagerBase.h"
 
 #include "AssetImporter.h"
+#include "TextureImporter.h"
+#include "FontImporter.h"
 
 #include "Nebula/Project/Project.h"
 #include "Nebula/Core/Application.h"
+#include "Nebula/Core/JobSystem.h"
 #include "Nebula/Renderer/Texture.h"
 #include "Nebula/Renderer/Fonts.h"
 
@@ -53,10 +56,17 @@ namespace Nebula
 
 			return AssetType::None;
 		}
+
+		// Paths written differently still share one key
+		static std::string GetPathKey(const std::filesystem::path& path)
+		{
+			return path.lexically_normal().generic_string();
+		}
 	}
 
 	// Note: Changing a global asset's index may mess up scenes and prefabs
 	AssetRegistry AssetManagerBase::s_GlobalRegistry = {};
+	AssetPathIndex AssetManagerBase::s_GlobalPathIndex = {};
 	uint16_t AssetManagerBase::s_GlobalIndex = 1;
 
 	/*void AssetManagerBase::OnAssetChange(const std::string& path, const filewatch::Event change_type)
@@ -118,6 +128,8 @@ namespace Nebula
 		data.RelativePath = relativePath;
 
 		m_AssetRegistry[handle] = data;
+		IndexPaths(m_PathIndex, data);
+		return true;
 	}
 	
 	bool AssetManagerBase::CreateAsset(AssetMetadata& metadata)
@@ -127,6 +139,8 @@ namespace Nebula
 			return false;
 
 		m_AssetRegistry[metadata.Handle] = metadata;
+		IndexPaths(m_PathIndex, metadata);
+		return true;
 	}
 
 	bool AssetManagerBase::CreateGlobalAsset(AssetMetadata& metadata)
@@ -137,7 +151,9 @@ namespace Nebula
 		metadata.Handle = s_GlobalIndex;
 
 		s_GlobalRegistry[s_GlobalIndex] = metadata;
+		IndexPaths(s_GlobalPathIndex, metadata);
 		s_GlobalIndex++;
+		return true;
 	}
 	
 	AssetHandle AssetManagerBase::CreateGlobalAsset(const std::filesystem::path& path, const std::filesystem::path& relativePath)
@@ -159,6 +175,7 @@ namespace Nebula
 		data.isGlobal = true;
 
 		s_GlobalRegistry[s_GlobalIndex] = data;
+		IndexPaths(s_GlobalPathIndex, data);
 		s_GlobalIndex++;
 
 		return data.Handle;
@@ -167,24 +184,56 @@ namespace Nebula
 	void AssetManagerBase::DeleteAsset(AssetHandle handle)
 	{
 		m_Assets.erase(handle);
-		m_AssetRegistry.erase(handle);
+
+		auto it = m_AssetRegistry.find(handle);
+		if (it == m_AssetRegistry.end())
+			return;
+
+		RemovePaths(m_PathIndex, it->second);
+		m_AssetRegistry.erase(it);
 	}
 
 	AssetHandle AssetManagerBase::GetHandleFromPath(const std::filesystem::path& path)
 	{
-		for (const auto& [handle, asset] : m_AssetRegistry)
+		return FindHandle(path);
+	}
+
+	AssetHandle AssetManagerBase::FindHandle(const std::filesystem::path& path) const
+	{
+		// Nothing is registered under a path that was never interned
+		NameID name;
+		if (!NameID::Find(Utils::GetPathKey(path), name))
+			return NULL;
+
+		auto it = m_PathIndex.find(name);
+		if (it != m_PathIndex.end())
+			return it->second;
+
+		it = s_GlobalPathIndex.find(name);
+		if (it != s_GlobalPathIndex.end())
+			return it->second;
+
+		return NULL;
+	}
+
+	void AssetManagerBase::IndexPaths(AssetPathIndex& index, const AssetMetadata& metadata)
+	{
+		// The first asset registered under a path keeps it
+		for (const std::filesystem::path* path : { &metadata.Path, &metadata.RelativePath })
 		{
-			if (asset.Path == path || asset.RelativePath == path)
-				return handle;
+			if (!path->empty())
+				index.emplace(NameID(Utils::GetPathKey(*path)), metadata.Handle);
 		}
-		
-		for (const auto& [handle, asset] : s_GlobalRegistry)
+	}
+
+	void AssetManagerBase::RemovePaths(AssetPathIndex& index, const AssetMetadata& metadata)
+	{
+		for (const std::filesystem::path* path : { &metadata.Path, &metadata.RelativePath })
 		{
-			if (asset.Path == path || asset.RelativePath == path)
-				return handle;
+			auto it = index.find(NameID(Utils::GetPathKey(*path)));
+			if (it != index.end() && it->second == metadata.Handle)
+				index.erase(it);
 		}
-
-		return NULL;
 	}
 
 	Ref<Asset> AssetManagerBase::FindAsset(AssetHandle handle)
@@ -206,7 +255,8 @@ namespace Nebula
 		if (IsAssetLoaded(handle))
 			return FindAsset(handle);
 		
-		const AssetMetadata& metadata = GetAssetMetadata(handle);
+		// Font families register their fonts while importing
+		AssetMetadata metadata = GetAssetMetadata(handle);
 		Ref<Asset> asset = AssetImporter::ImportAsset(handle, metadata);
 		
 		if (!asset)
@@ -216,6 +266,79 @@ namespace Nebula
 		return asset;
 	}
 
+	void AssetManagerBase::LoadAssets(const Array<AssetHandle>& handles)
+	{
+		NB_PROFILE_FUNCTION();
+
+		struct PendingAsset
+		{
+			AssetHandle Handle;
+			AssetMetadata Metadata;
+
+			Ref<Asset> Loaded;
+			Buffer TextureData;
+			TextureSpecification TextureSpec;
+		};
+
+		Array<PendingAsset> pending;
+		Array<AssetHandle> queue = handles;
+
+		for (uint32_t i = 0; i < queue.size(); i++)
+		{
+			AssetHandle handle = queue[i];
+			if (!IsHandleValid(handle) || IsAssetLoaded(handle))
+				continue;
+
+			if (std::find_if(pending.begin(), pending.end(), [handle](const PendingAsset& asset) { return asset.Handle == handle; }) != pending.end())
+				continue;
+
+			const AssetMetadata& metadata = GetAssetMetadata(handle);
+			if (metadata.Type == AssetType::Texture || metadata.Type == AssetType::Font)
+			{
+				pending.push_back({ handle, metadata });
+				continue;
+			}
+
+			// Other importers can add to the registry, so they stay on this thread
+			Ref<Asset> asset = GetAsset(handle);
+			if (!asset || asset->GetType() != AssetType::FontFamily)
+				continue;
+
+			Ref<FontFamily> family = std::static_pointer_cast<FontFamily>(asset);
+			for (AssetHandle font : { family->Regular, family->Bold, family->BoldItalic, family->Italic })
+				queue.push_back(font);
+		}
+
+		JobSystem::ParallelFor((uint32_t)pending.size(), 1, [&pending](uint32_t begin, uint32_t end) {
+			for (uint32_t i = begin; i < end; i++)
+			{
+				PendingAsset& asset = pending[i];
+				if (asset.Metadata.Type == AssetType::Texture)
+					asset.TextureData = TextureImporter::LoadTexture2DData(asset.Metadata.Path.string(), asset.TextureSpec);
+				else
+					asset.Loaded = FontImporter::ImportFontDeferred(asset.Handle, asset.Metadata);
+			}
+		});
+
+		for (PendingAsset& asset : pending)
+		{
+			if (asset.Metadata.Type == AssetType::Texture)
+			{
+				if (!asset.TextureData)
+					continue;
+
+				asset.Loaded = Texture2D::Create(asset.TextureSpec, asset.TextureData);
+				asset.TextureData.Release();
+			}
+			else
+			{
+				std::static_pointer_cast<Font>(asset.Loaded)->UploadAtlas();
+			}
+
+			m_Assets[asset.Handle] = asset.Loaded;
+		}
+	}
+
 	const AssetMetadata& AssetManagerBase::GetAssetMetadata(AssetHandle handle) const
 	{
 		static AssetMetadata s_NullMetadata;
@@ -234,21 +357,7 @@ namespace Nebula
 	const AssetMetadata& AssetManagerBase::GetAssetMetadata(const std::filesystem::path& path) const
 	{
 		NB_PROFILE_FUNCTION();
-		static AssetMetadata s_NullMetadata;
-
-		for (auto [handle, metadata] : m_AssetRegistry)
-		{
-			if (metadata.Path == path || metadata.RelativePath == path)
-				return metadata;
-		}
-		
-		for (auto [handle, metadata] : s_GlobalRegistry)
-		{
-			if (metadata.Path == path || metadata.RelativePath == path)
-				return metadata;
-		}
-
-		return s_NullMetadata;
+		return GetAssetMetadata(FindHandle(path));
 	}
 
 	Array<AssetHandle> AssetManagerBase::GetAllAssetsWithType(AssetType type, bool global)
@@ -339,10 +448,15 @@ namespace Nebula
 				continue;
 
 			auto& metadata = m_AssetRegistry[handle];
+			RemovePaths(m_PathIndex, metadata);
+
 			metadata.Handle = handle;
 			metadata.Path = assetPath;
 			metadata.RelativePath = node["RelativePath"].as<std::string>();
 			metadata.Type = Utils::AssetTypeFromString(type);
+			IndexPaths(m_PathIndex, metadata);
 		}
+
+		return true;
 	}
 }
\ No newline at end of file
@@ -1,15 +1,20 @@
 #pragma once
 
 #include "Nebula/Core/API.h"
+#include "Nebula/Core/NameID.h"
 #include "Nebula/Utils/Arrays.h"
+#include "Nebula/Utils/FlatHashMap.h"
 #include "Asset.h"
 
 #include <unordered_map>
 
 namespace Nebula
 {
-	using AssetMap = std::unordered_map<AssetHandle, Ref<Asset>>;
-	using AssetRegistry = std::unordered_map<AssetHandle, AssetMetadata>;
+	using AssetMap = FlatHashMap<AssetHandle, Ref<Asset>>;
+	// Registering an asset can move the others, don't keep metadata references across it
+	using AssetRegistry = FlatHashMap<AssetHandle, AssetMetadata>;
+	// Interned absolute and relative paths, in generic format
+	using AssetPathIndex = std::unordered_map<NameID, AssetHandle>;
 
 	class AssetManagerBase
 	{
@@ -26,6 +31,9 @@ namespace Nebula
 		void DeleteAsset(AssetHandle handle);
 
 		Ref<Asset> GetAsset(AssetHandle handle, bool load = true);
+		// Imports every asset that isn't loaded yet, decoding textures and fonts on the job system.
+		// Call from the main thread, the graphics API is only touched there
+		void LoadAssets(const Array<AssetHandle>& handles);
 		const AssetMetadata& GetAssetMetadata(AssetHandle handle) const;
 		const AssetMetadata& GetAssetMetadata(const std::filesystem::path& path) const;
 		AssetHandle GetHandleFromPath(const std::filesystem::path& path);
@@ -44,11 +52,18 @@ namespace Nebula
 		
 		Ref<Asset> FindAsset(AssetHandle handle);
 		static Ref<Asset> FindGlobalAsset(AssetHandle handle);
+
+		AssetHandle FindHandle(const std::filesystem::path& path) const;
+		static void IndexPaths(AssetPathIndex& index, const AssetMetadata& metadata);
+		static void RemovePaths(AssetPathIndex& index, const AssetMetadata& metadata);
 	private:
 		AssetRegistry m_AssetRegistry;
 		AssetMap m_Assets;
+		// Kept next to the registries so path lookups don't walk them
+		AssetPathIndex m_PathIndex;
 
 		static AssetRegistry s_GlobalRegistry;
+		static AssetPathIndex s_GlobalPathIndex;
 		static uint16_t s_GlobalIndex;
 	};
 }
\ No newline at end of file
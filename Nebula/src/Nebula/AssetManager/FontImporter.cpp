@@ -9,22 +9,29 @@
 
 namespace Nebula
 {
-	Ref<Font> FontImporter::ImportFont(AssetHandle handle, const AssetMetadata& metadata)
+	namespace Utils
 	{
-		std::filesystem::path path = metadata.Path;
-		std::filesystem::path filename = metadata.RelativePath;
-		filename = filename.replace_extension();
-
-		std::filesystem::path cachePath;
-		if (metadata.isGlobal)
-			cachePath = "Resources/cache/font/" + filename.string() + ".png";
-		else
+		static std::filesystem::path GetFontCachePath(const AssetMetadata& metadata)
 		{
-			cachePath = Project::GetActive()->GetProjectDirectory() / "Cache" /
+			std::filesystem::path filename = metadata.RelativePath;
+			filename = filename.replace_extension();
+
+			if (metadata.isGlobal)
+				return "Resources/cache/font/" + filename.string() + ".png";
+			
+			return Project::GetActive()->GetProjectDirectory() / "Cache" /
 				(filename.string() + ".png");
 		}
-		
-		return CreateRef<Font>(path, cachePath);
+	}
+
+	Ref<Font> FontImporter::ImportFont(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		return CreateRef<Font>(metadata.Path, Utils::GetFontCachePath(metadata));
+	}
+
+	Ref<Font> FontImporter::ImportFontDeferred(AssetHandle handle, const AssetMetadata& metadata)
+	{
+		return CreateRef<Font>(metadata.Path, Utils::GetFontCachePath(metadata), true);
 	}
 	
 	Ref<FontFamily> FontImporter::ImportFontFamily(AssetHandle handle, const AssetMetadata& metadata)
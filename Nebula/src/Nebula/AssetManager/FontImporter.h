@@ -8,6 +8,8 @@ namespace Nebula
 	{
 	public:
 		static Ref<Font> ImportFont(AssetHandle handle, const AssetMetadata& metadata);
+		// Leaves Font::UploadAtlas() to the caller, so it can run on any thread
+		static Ref<Font> ImportFontDeferred(AssetHandle handle, const AssetMetadata& metadata);
 		static Ref<FontFamily> ImportFontFamily(AssetHandle handle, const AssetMetadata& metadata);
 	};
 }
\ No newline at end of file
@@ -14,6 +14,20 @@ namespace Nebula
 	{
 		NB_PROFILE_FUNCTION();
 
+		TextureSpecification spec;
+		Buffer data = LoadTexture2DData(path, spec);
+		if (!data)
+			return nullptr;
+
+		Ref<Texture2D> texture = Texture2D::Create(spec, data);
+		data.Release();
+		return texture;
+	}
+
+	Buffer TextureImporter::LoadTexture2DData(std::string_view path, TextureSpecification& outSpec)
+	{
+		NB_PROFILE_FUNCTION();
+
 		int width, height, channels;
 		stbi_set_flip_vertically_on_load(1);
 		
@@ -24,25 +38,22 @@ namespace Nebula
 		if (!data)
 		{
 			NB_ERROR("[Texture Importer] Failed loading texture from path: {}", path);
-			return nullptr;
+			return Buffer();
 		}
 
-		TextureSpecification spec;
-		spec.Width = width;
-		spec.Height = height;
+		outSpec.Width = width;
+		outSpec.Height = height;
 
 		switch (channels)
 		{
 		case 3:
-			spec.Format = ImageFormat::RGB8;
+			outSpec.Format = ImageFormat::RGB8;
 			break;
 		case 4:
-			spec.Format = ImageFormat::RGBA8;
+			outSpec.Format = ImageFormat::RGBA8;
 			break;
 		}
 
-		Ref<Texture2D> texture = Texture2D::Create(spec, data);
-		data.Release();
-		return texture;
+		return data;
 	}
 }
\ No newline at end of file
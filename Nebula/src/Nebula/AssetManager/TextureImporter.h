@@ -9,5 +9,9 @@ namespace Nebula
 	public:
 		static Ref<Texture2D> ImportTexture2D(AssetHandle handle, const AssetMetadata& metadata);
 		static Ref<Texture2D> CreateTexture2D(std::string_view path);
+
+		// Decodes the image without touching the graphics API, safe to call from any thread.
+		// The caller owns the returned buffer
+		static Buffer LoadTexture2DData(std::string_view path, TextureSpecification& outSpec);
 	};
 }
\ No newline at end of file
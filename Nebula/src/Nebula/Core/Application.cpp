@@ -1,8 +1,14 @@
 #include "nbpch.h"
 #include "Application.h"
 
+#include "TaskGraph.h"
+#include "JobSystem.h"
+
 #include "Nebula/Renderer/Renderer.h"
+#include "Nebula/Renderer/FrameBuffer.h"
+#include "Nebula/Renderer/Fonts.h"
 #include "Nebula/Scripting/ScriptEngine.h"
+#include "Nebula/Project/Project.h"
 
 namespace Nebula {
 	Application* Application::s_Instance = nullptr;
@@ -16,12 +22,28 @@ namespace Nebula {
 		if (!m_Specification.WorkingDirectory.empty())
 			std::filesystem::current_path(m_Specification.WorkingDirectory);
 
-		m_Window = Window::Create(WindowProps(m_Specification.Name));
-		m_Window->SetEventCallback(BIND_EVENT(Application::OnEvent));
+		JobSystem::Init();
+
+		// Anything touching the graphics context or the mono domain stays on the main thread
+		TaskGraph startup;
+		auto window = startup.Add("Window", TaskGraph::Thread::Main, [this]() {
+			m_Window = Window::Create(WindowProps(m_Specification.Name));
+			m_Window->SetEventCallback(BIND_EVENT(Application::OnEvent));
+			Time::Init();
+		});
+
+		auto renderer = startup.Add("Renderer", TaskGraph::Thread::Main, []() { Renderer::Init(); }, { { window } });
+		auto font = startup.Add("Default Font", TaskGraph::Thread::Worker, []() { Font::LoadDefault(true); });
+		startup.Add("Font Atlas Upload", TaskGraph::Thread::Main, []() { Font::GetDefault(); }, { { renderer, font } });
+
+		auto project = startup.Add("Project", TaskGraph::Thread::Worker, [this]() {
+			if (!m_Specification.ProjectPath.empty() && !Project::Load(m_Specification.ProjectPath))
+				NB_ERROR("[Application] Could not load project '{}'", m_Specification.ProjectPath.string());
+		});
 
-		Time::Init();
-		Renderer::Init();
-		ScriptEngine::Init();
+		// Loads the app assembly if the project loaded
+		startup.Add("Script Engine", TaskGraph::Thread::Main, []() { ScriptEngine::Init(); }, { { project } });
+		startup.Run();
 
 		m_ImGui = new ImGuiLayer();
 		PushOverlay(m_ImGui);
@@ -30,6 +52,8 @@ namespace Nebula {
 	Application::~Application() {
 		NB_PROFILE_FUNCTION();
 
+		// Workers finish before anything they may use goes away
+		JobSystem::Shutdown();
 		ScriptEngine::Shutdown();
 		Renderer::Shutdown();
 	}
@@ -43,6 +67,7 @@ namespace Nebula {
 			
 			Time::Update();
 			ExecuteMainThreadQueue();
+			JobSystem::RunMainThreadJobs();
 
 			if (!m_Minimized) {
 				for (Layer* layer : m_LayerStack) {
@@ -56,6 +81,7 @@ namespace Nebula {
 				layer->ImGuiRender();
 			m_ImGui->End();
 
+			FrameBuffer::TrimPool();
 			m_Window->Update();
 		}
 	}
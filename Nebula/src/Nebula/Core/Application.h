@@ -31,6 +31,9 @@ namespace Nebula {
 		std::string Name = "Nebula App";
 		ApplicationCommandLineArgs CommandLineArgs;
 		std::string WorkingDirectory;
+
+		// Loaded during startup, alongside the engine
+		std::filesystem::path ProjectPath;
 	};
 
 	class Application
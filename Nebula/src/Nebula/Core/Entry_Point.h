@@ -7,10 +7,30 @@ extern Nebula::Application* Nebula::CreateApplication(ApplicationCommandLineArgs
 int main(int argc, char** argv) {
 	Nebula::Log::Init();
 
+	// --startup-timeline <path> writes the startup tasks as a trace file, the application never sees it
+	const char* timelinePath = nullptr;
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (std::string_view(argv[i]) != "--startup-timeline")
+			continue;
+
+		timelinePath = argv[i + 1];
+		for (int j = i; j + 2 <= argc; j++)
+			argv[j] = argv[j + 2];
+		argc -= 2;
+		break;
+	}
+
+	if (timelinePath)
+		Nebula::Instrumentor::Get().BeginTimeline();
+
 	NB_PROFILE_BEGIN_SESSION("Startup", "NebulaProfile-Startup.json");
 	auto app = Nebula::CreateApplication({ argc, argv });
 	NB_PROFILE_END_SESSION();
 
+	if (timelinePath)
+		Nebula::Instrumentor::Get().WriteTimeline(timelinePath);
+
 	NB_PROFILE_BEGIN_SESSION("Runtime", "NebulaProfile-Runtime.json");
 	app->run();
 	NB_PROFILE_END_SESSION();
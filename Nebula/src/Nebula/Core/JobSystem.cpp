@@ -0,0 +1,376 @@
+#include "nbpch.h"
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Nebula {
+	struct QueuedJob
+	{
+		JobSystem::Job Function;
+		JobCounter* Counter = nullptr;
+		JobAffinity Affinity = JobAffinity::Any;
+		std::string Name;
+	};
+
+	struct JobQueue
+	{
+		std::mutex Mutex;
+		std::deque<QueuedJob> Jobs;
+
+		std::atomic<uint64_t> BusyTime = 0;
+	};
+
+	struct Continuation
+	{
+		const JobCounter* Counter = nullptr;
+		QueuedJob Job;
+	};
+
+	struct JobSystemData
+	{
+		// Index 0 belongs to the main thread, the rest to the workers
+		Array<Scope<JobQueue>> Queues;
+		Array<std::thread> Workers;
+
+		std::thread::id MainThread;
+		JobQueue MainThreadJobs;
+
+		// Jobs sitting in a queue the workers can reach, workers sleep while it is zero
+		std::atomic<uint32_t> QueuedJobs = 0;
+		std::atomic<bool> Running = false;
+
+		std::mutex SleepMutex;
+		std::condition_variable WakeCondition;
+
+		// Counters only reach zero with this held, so a continuation can't be added after its counter finished
+		std::mutex ContinuationMutex;
+		Array<Continuation> Continuations;
+
+		JobHooks Hooks;
+	};
+
+	static JobSystemData* s_Data = nullptr;
+	static thread_local uint32_t s_ThreadIndex = 0;
+
+	namespace Utils {
+		static bool PopJob(JobQueue& queue, QueuedJob& outJob) {
+			std::scoped_lock lock(queue.Mutex);
+			if (queue.Jobs.empty())
+				return false;
+
+			outJob = std::move(queue.Jobs.back());
+			queue.Jobs.pop_back();
+			return true;
+		}
+
+		static bool PopMainThreadJob(QueuedJob& outJob) {
+			JobQueue& queue = s_Data->MainThreadJobs;
+
+			std::scoped_lock lock(queue.Mutex);
+			if (queue.Jobs.empty())
+				return false;
+
+			outJob = std::move(queue.Jobs.front());
+			queue.Jobs.pop_front();
+			return true;
+		}
+
+		static bool StealJob(uint32_t index, QueuedJob& outJob) {
+			uint32_t count = (uint32_t)s_Data->Queues.size();
+			for (uint32_t offset = 1; offset < count; offset++)
+			{
+				JobQueue& queue = *s_Data->Queues[(index + offset) % count];
+
+				std::scoped_lock lock(queue.Mutex);
+				if (queue.Jobs.empty())
+					continue;
+
+				outJob = std::move(queue.Jobs.front());
+				queue.Jobs.pop_front();
+				return true;
+			}
+
+			return false;
+		}
+	}
+
+	bool JobSystem::RunJob(uint32_t index) {
+		QueuedJob job;
+		if (index == 0 && IsMainThread() && Utils::PopMainThreadJob(job))
+		{
+			ExecuteJob(job, index);
+			return true;
+		}
+
+		if (!Utils::PopJob(*s_Data->Queues[index], job) && !Utils::StealJob(index, job))
+			return false;
+
+		s_Data->QueuedJobs--;
+		ExecuteJob(job, index);
+		return true;
+	}
+
+	void JobSystem::WorkerLoop(uint32_t index) {
+		s_ThreadIndex = index;
+
+		while (s_Data->Running)
+		{
+			if (RunJob(index))
+				continue;
+
+			std::unique_lock lock(s_Data->SleepMutex);
+			s_Data->WakeCondition.wait(lock, []() { return s_Data->QueuedJobs > 0 || !s_Data->Running; });
+		}
+	}
+
+	void JobSystem::Enqueue(QueuedJob& job) {
+		if (job.Affinity == JobAffinity::MainThread)
+		{
+			std::scoped_lock lock(s_Data->MainThreadJobs.Mutex);
+			s_Data->MainThreadJobs.Jobs.push_back(std::move(job));
+			return;
+		}
+
+		if (s_Data->Workers.empty())
+		{
+			ExecuteJob(job, s_ThreadIndex);
+			return;
+		}
+
+		// Counted first, so the count never drops below zero when a thief is quick
+		s_Data->QueuedJobs++;
+
+		JobQueue& queue = *s_Data->Queues[s_ThreadIndex];
+		{
+			std::scoped_lock lock(queue.Mutex);
+			queue.Jobs.push_back(std::move(job));
+		}
+
+		// Taking the lock makes sure a worker between its check and its wait still sees the job
+		{
+			std::scoped_lock lock(s_Data->SleepMutex);
+		}
+		s_Data->WakeCondition.notify_one();
+	}
+
+	void JobSystem::ExecuteJob(QueuedJob& job, uint32_t index) {
+		const JobHooks& hooks = s_Data->Hooks;
+		if (hooks.OnJobStart)
+			hooks.OnJobStart(job.Name, index);
+
+		auto start = std::chrono::steady_clock::now();
+		job.Function();
+		auto end = std::chrono::steady_clock::now();
+
+		uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+		s_Data->Queues[index]->BusyTime += nanoseconds;
+
+#ifdef NB_PROFILE
+		if (!job.Name.empty())
+			Instrumentor::Get().WriteProfile({ job.Name, FloatingPointMicroseconds{ start.time_since_epoch() }, end - start, std::this_thread::get_id() });
+#endif
+
+		if (hooks.OnJobFinish)
+			hooks.OnJobFinish(job.Name, index, nanoseconds);
+
+		if (job.Counter)
+			FinishJob(job.Counter);
+	}
+
+	void JobSystem::FinishJob(JobCounter* counter) {
+		std::atomic<uint32_t>& count = counter->m_Count;
+
+		// Anything but the last job can leave without the lock
+		uint32_t remaining = count.load(std::memory_order_relaxed);
+		while (remaining > 1)
+		{
+			if (count.compare_exchange_weak(remaining, remaining - 1, std::memory_order_release, std::memory_order_relaxed))
+				return;
+		}
+
+		Array<QueuedJob> ready;
+		{
+			std::scoped_lock lock(s_Data->ContinuationMutex);
+
+			// Once it hits zero a waiter may free the counter, it is only used as a key after that
+			if (count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+
+			for (size_t i = 0; i < s_Data->Continuations.size();)
+			{
+				if (s_Data->Continuations[i].Counter != counter)
+				{
+					i++;
+					continue;
+				}
+
+				ready.push_back(std::move(s_Data->Continuations[i].Job));
+				s_Data->Continuations[i] = std::move(s_Data->Continuations.back());
+				s_Data->Continuations.pop_back();
+			}
+		}
+
+		for (QueuedJob& job : ready)
+			Enqueue(job);
+	}
+
+	void JobSystem::Init(uint32_t workerCount) {
+		NB_PROFILE_FUNCTION();
+		NB_ASSERT(!s_Data, "[JobSystem] Already initialised");
+
+		if (workerCount == 0)
+			workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		s_Data = new JobSystemData();
+		s_Data->MainThread = std::this_thread::get_id();
+		s_Data->Running = true;
+
+		for (uint32_t i = 0; i <= workerCount; i++)
+			s_Data->Queues.push_back(CreateScope<JobQueue>());
+
+		for (uint32_t i = 1; i <= workerCount; i++)
+			s_Data->Workers.emplace_back(WorkerLoop, i);
+
+		NB_INFO("[JobSystem] Started {0} workers", workerCount);
+	}
+
+	void JobSystem::Shutdown() {
+		if (!s_Data)
+			return;
+
+		{
+			std::scoped_lock lock(s_Data->SleepMutex);
+			s_Data->Running = false;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data->Workers)
+			worker.join();
+
+		// Whatever is left for the main thread still gets to run
+		RunMainThreadJobs();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	uint32_t JobSystem::GetWorkerCount() {
+		return s_Data ? (uint32_t)s_Data->Workers.size() : 0;
+	}
+
+	uint32_t JobSystem::GetThreadIndex() {
+		return s_ThreadIndex;
+	}
+
+	bool JobSystem::IsMainThread() {
+		return s_Data && std::this_thread::get_id() == s_Data->MainThread;
+	}
+
+	void JobSystem::Submit(const Job& job, JobCounter* counter, JobAffinity affinity) {
+		Submit(std::string(), job, counter, affinity);
+	}
+
+	void JobSystem::Submit(const std::string& name, const Job& job, JobCounter* counter, JobAffinity affinity) {
+		if (!s_Data)
+		{
+			job();
+			return;
+		}
+
+		if (counter)
+			counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		QueuedJob queued = { job, counter, affinity, name };
+		Enqueue(queued);
+	}
+
+	void JobSystem::Then(JobCounter& counter, const Job& job, JobCounter* next, JobAffinity affinity) {
+		// Nothing can be pending without the job system
+		if (!s_Data)
+		{
+			job();
+			return;
+		}
+
+		if (next)
+			next->m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		QueuedJob queued = { job, next, affinity };
+		{
+			std::scoped_lock lock(s_Data->ContinuationMutex);
+			if (!counter.IsDone())
+			{
+				s_Data->Continuations.push_back({ &counter, std::move(queued) });
+				return;
+			}
+		}
+
+		Enqueue(queued);
+	}
+
+	void JobSystem::Wait(JobCounter& counter) {
+		while (!counter.IsDone())
+		{
+			if (!s_Data || !RunJob(s_ThreadIndex))
+				std::this_thread::yield();
+		}
+	}
+
+	bool JobSystem::RunPendingJob() {
+		return s_Data && RunJob(s_ThreadIndex);
+	}
+
+	void JobSystem::RunMainThreadJobs() {
+		if (!s_Data)
+			return;
+
+		NB_ASSERT(IsMainThread(), "[JobSystem] Main thread jobs run on the main thread");
+
+		// Jobs queued while these run wait for the next call
+		std::deque<QueuedJob> jobs;
+		{
+			std::scoped_lock lock(s_Data->MainThreadJobs.Mutex);
+			jobs.swap(s_Data->MainThreadJobs.Jobs);
+		}
+
+		for (QueuedJob& job : jobs)
+			ExecuteJob(job, 0);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t chunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function) {
+		if (count == 0)
+			return;
+
+		chunkSize = std::max(chunkSize, 1u);
+		if (count <= chunkSize || GetWorkerCount() == 0)
+		{
+			function(0, count);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t begin = chunkSize; begin < count; begin += chunkSize)
+		{
+			uint32_t end = std::min(begin + chunkSize, count);
+			Submit([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		function(0, chunkSize);
+		Wait(counter);
+	}
+
+	uint64_t JobSystem::GetBusyTime(uint32_t threadIndex) {
+		if (!s_Data || threadIndex >= s_Data->Queues.size())
+			return 0;
+
+		return s_Data->Queues[threadIndex]->BusyTime;
+	}
+
+	void JobSystem::SetHooks(const JobHooks& hooks) {
+		NB_ASSERT(s_Data, "[JobSystem] Hooks are set after Init");
+		s_Data->Hooks = hooks;
+	}
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Nebula/Core/API.h"
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+namespace Nebula {
+	struct QueuedJob;
+
+	// Counts unfinished jobs, JobSystem::Wait returns once it is back to zero
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+	private:
+		std::atomic<uint32_t> m_Count = 0;
+
+		friend class JobSystem;
+	};
+
+	enum class JobAffinity { Any = 0, MainThread };
+
+	// Called on the thread running the job, the name is empty for unnamed jobs
+	struct JobHooks
+	{
+		std::function<void(const std::string& name, uint32_t thread)> OnJobStart;
+		std::function<void(const std::string& name, uint32_t thread, uint64_t nanoseconds)> OnJobFinish;
+	};
+
+	// A fixed set of worker threads, one per core besides the main thread.
+	// Every thread owns a deque: it runs its newest job from the back while idle threads steal the oldest from the front.
+	// Threads outside the pool submit to the main thread's deque, which the workers steal from.
+	// Main thread jobs never run on a worker, they run whenever the main thread waits or calls RunMainThreadJobs().
+	class JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+
+		// Zero workers picks one per core, leaving one for the main thread
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		static uint32_t GetWorkerCount();
+		// 0 for the main thread and anything outside the pool, workers start at 1
+		static uint32_t GetThreadIndex();
+		static bool IsMainThread();
+
+		// Runs the job straight away if there are no workers
+		static void Submit(const Job& job, JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+		// Named jobs are passed to the hooks and show up in profiling sessions
+		static void Submit(const std::string& name, const Job& job, JobCounter* counter = nullptr, JobAffinity affinity = JobAffinity::Any);
+		// Submits the job once the counter is back to zero, or straight away if it already is.
+		// The next counter counts the job from now on, so waiting on it also waits for the first counter
+		static void Then(JobCounter& counter, const Job& job, JobCounter* next = nullptr, JobAffinity affinity = JobAffinity::Any);
+
+		// Runs queued jobs while it waits, so jobs can wait on other jobs
+		static void Wait(JobCounter& counter);
+		// Runs one queued job on the calling thread, false if there was none
+		static bool RunPendingJob();
+		// Runs every main thread job queued so far, Application calls it once a frame
+		static void RunMainThreadJobs();
+
+		// Splits [0, count) into chunks of up to chunkSize, the calling thread takes the first one.
+		// Returns once every chunk has run
+		static void ParallelFor(uint32_t count, uint32_t chunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function);
+
+		// Nanoseconds a thread has spent running jobs since Init, indexed like GetThreadIndex
+		static uint64_t GetBusyTime(uint32_t threadIndex);
+		// Set before submitting any jobs, the hooks are read without a lock
+		static void SetHooks(const JobHooks& hooks);
+	private:
+		static bool RunJob(uint32_t threadIndex);
+		static void WorkerLoop(uint32_t threadIndex);
+
+		static void Enqueue(QueuedJob& job);
+		static void ExecuteJob(QueuedJob& job, uint32_t threadIndex);
+		static void FinishJob(JobCounter* counter);
+	};
+}
@@ -0,0 +1,77 @@
+#include "nbpch.h"
+#include "NameID.h"
+
+#include <deque>
+#include <shared_mutex>
+
+namespace Nebula {
+	struct NameTable
+	{
+		std::shared_mutex Mutex;
+
+		// Indexed by id, a deque never moves its elements so the keys below can point into it
+		std::deque<std::string> Strings = { std::string() };
+		std::unordered_map<std::string_view, uint32_t> IDs = { { std::string_view(), 0 } };
+	};
+
+	// Created on first use, names may be interned during static initialisation
+	static NameTable& GetNameTable() {
+		static NameTable s_Table;
+		return s_Table;
+	}
+
+	NameID::NameID(std::string_view text) {
+		if (text.empty())
+			return;
+
+		NameTable& table = GetNameTable();
+		{
+			std::shared_lock lock(table.Mutex);
+
+			auto it = table.IDs.find(text);
+			if (it != table.IDs.end())
+			{
+				m_ID = it->second;
+				return;
+			}
+		}
+
+		std::unique_lock lock(table.Mutex);
+
+		// Another thread may have added it between the two locks
+		auto it = table.IDs.find(text);
+		if (it != table.IDs.end())
+		{
+			m_ID = it->second;
+			return;
+		}
+
+		NB_ASSERT(table.Strings.size() < UINT32_MAX, "[NameID] Name table is full");
+
+		m_ID = (uint32_t)table.Strings.size();
+		const std::string& stored = table.Strings.emplace_back(text);
+		table.IDs.emplace(stored, m_ID);
+	}
+
+	bool NameID::Find(std::string_view text, NameID& outName) {
+		NameTable& table = GetNameTable();
+		std::shared_lock lock(table.Mutex);
+
+		auto it = table.IDs.find(text);
+		if (it == table.IDs.end())
+			return false;
+
+		outName.m_ID = it->second;
+		return true;
+	}
+
+	const std::string& NameID::GetString() const {
+		static const std::string s_Empty;
+		if (m_ID == 0)
+			return s_Empty;
+
+		NameTable& table = GetNameTable();
+		std::shared_lock lock(table.Mutex);
+		return table.Strings[m_ID];
+	}
+}
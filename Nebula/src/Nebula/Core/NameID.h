@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace Nebula {
+	// An interned string. Every distinct string gets one 32-bit id from a global table,
+	// so copying, comparing and hashing a NameID never touches the text.
+	// The table only grows and never moves a string, references from GetString() stay valid.
+	// Names can be created and read from any thread.
+	class NameID {
+	public:
+		// The empty string
+		NameID() = default;
+		NameID(std::string_view text);
+		NameID(const std::string& text) : NameID(std::string_view(text)) { }
+		NameID(const char* text) : NameID(std::string_view(text)) { }
+		NameID(const NameID&) = default;
+
+		// Looks the text up without adding it, false if nothing has interned it yet
+		static bool Find(std::string_view text, NameID& outName);
+
+		const std::string& GetString() const;
+		uint32_t GetID() const { return m_ID; }
+		bool IsEmpty() const { return m_ID == 0; }
+
+		bool operator==(const NameID& other) const { return m_ID == other.m_ID; }
+		bool operator!=(const NameID& other) const { return m_ID != other.m_ID; }
+	private:
+		uint32_t m_ID = 0;
+	};
+}
+
+namespace std {
+	template<>
+	struct hash<Nebula::NameID> {
+		std::size_t operator()(const Nebula::NameID& name) const {
+			return name.GetID();
+		}
+	};
+}
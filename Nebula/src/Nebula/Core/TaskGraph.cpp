@@ -0,0 +1,93 @@
+#include "nbpch.h"
+#include "TaskGraph.h"
+
+#include "JobSystem.h"
+
+namespace Nebula {
+	TaskGraph::TaskID TaskGraph::Add(const std::string& name, Thread thread, const std::function<void()>& function, const Array<TaskID>& dependencies) {
+		TaskID id = (TaskID)m_Tasks.size();
+
+		Task task;
+		task.Name = name;
+		task.RunOn = thread;
+		task.Function = function;
+		task.RemainingDependencies = (uint32_t)dependencies.size();
+
+		for (TaskID dependency : dependencies) {
+			NB_ASSERT(dependency < id, "[TaskGraph] Dependencies must be added before the tasks that use them");
+			m_Tasks[dependency].Dependents.push_back(id);
+		}
+
+		m_Tasks.push_back(task);
+		return id;
+	}
+
+	void TaskGraph::Run() {
+		NB_PROFILE_FUNCTION();
+
+		bool hasWorkers = JobSystem::GetWorkerCount() > 0;
+		JobCounter workers;
+
+		std::unique_lock lock(m_Mutex);
+		while (m_FinishedCount < m_Tasks.size()) {
+			TaskID mainTask = (TaskID)m_Tasks.size();
+
+			for (TaskID id = 0; id < m_Tasks.size(); id++) {
+				Task& task = m_Tasks[id];
+				if (task.Started || task.RemainingDependencies)
+					continue;
+
+				// Without workers everything runs here, in the order it becomes ready
+				if (task.RunOn == Thread::Worker && hasWorkers) {
+					task.Started = true;
+					JobSystem::Submit([this, id]() { Execute(id); }, &workers);
+				}
+				else if (mainTask == m_Tasks.size()) {
+					mainTask = id;
+				}
+			}
+
+			if (mainTask < m_Tasks.size()) {
+				m_Tasks[mainTask].Started = true;
+
+				lock.unlock();
+				Execute(mainTask);
+				lock.lock();
+				continue;
+			}
+
+			// Help with queued jobs until a task finishes
+			size_t finishedCount = m_FinishedCount;
+			lock.unlock();
+			bool ranJob = JobSystem::RunPendingJob();
+			lock.lock();
+
+			if (!ranJob)
+				m_Condition.wait(lock, [&]() { return m_FinishedCount != finishedCount; });
+		}
+		lock.unlock();
+
+		// The last tasks may still be returning
+		JobSystem::Wait(workers);
+
+		m_Tasks.clear();
+		m_FinishedCount = 0;
+	}
+
+	void TaskGraph::Execute(TaskID id) {
+		const Task& task = m_Tasks[id];
+
+		auto start = std::chrono::steady_clock::now();
+		task.Function();
+		auto end = std::chrono::steady_clock::now();
+
+		Instrumentor::Get().RecordTimelineEvent(task.Name, start, end, std::this_thread::get_id());
+
+		std::scoped_lock lock(m_Mutex);
+		for (TaskID dependent : task.Dependents)
+			m_Tasks[dependent].RemainingDependencies--;
+
+		m_FinishedCount++;
+		m_Condition.notify_all();
+	}
+}
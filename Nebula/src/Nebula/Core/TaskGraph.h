@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Utils/Arrays.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace Nebula {
+	// Runs a set of named tasks once their dependencies have finished.
+	// Worker tasks go to the job system, main thread tasks run on the thread that calls Run(), which helps with worker tasks while it waits.
+	// Every task is recorded in the instrumentor's timeline.
+	class TaskGraph
+	{
+	public:
+		enum class Thread { Main = 0, Worker };
+		using TaskID = uint32_t;
+
+		TaskGraph() = default;
+		TaskGraph(const TaskGraph&) = delete;
+
+		// Dependencies must have been added before the task that waits on them
+		TaskID Add(const std::string& name, Thread thread, const std::function<void()>& function, const Array<TaskID>& dependencies = {});
+
+		// Blocks until every task has finished
+		void Run();
+	private:
+		void Execute(TaskID id);
+	private:
+		struct Task
+		{
+			std::string Name;
+			Thread RunOn = Thread::Main;
+			std::function<void()> Function;
+
+			Array<TaskID> Dependents;
+			uint32_t RemainingDependencies = 0;
+			bool Started = false;
+		};
+
+		Array<Task> m_Tasks;
+		size_t m_FinishedCount = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+	};
+}
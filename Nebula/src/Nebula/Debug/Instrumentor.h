@@ -6,6 +6,7 @@
 #include <iomanip>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace Nebula {
 	using FloatingPointMicroseconds = std::chrono::duration<double, std::micro>;
@@ -17,6 +18,13 @@ namespace Nebula {
 		std::thread::id ThreadID;
 	};
 
+	struct TimelineEvent
+	{
+		std::string Name;
+		std::chrono::steady_clock::time_point Start, End;
+		std::thread::id ThreadID;
+	};
+
 	struct InstrumentationSession
 	{
 		std::string Name;
@@ -88,6 +96,70 @@ namespace Nebula {
 			}
 		}
 
+		// Timelines are switched on at runtime rather than by NB_PROFILE, so boot times can be tracked in release builds
+		void BeginTimeline()
+		{
+			std::lock_guard lock(m_Mutex);
+			m_TimelineEnabled = true;
+		}
+
+		// Only kept while a timeline is recording, otherwise just forwarded to the profiling session
+		void RecordTimelineEvent(const std::string& name, std::chrono::steady_clock::time_point start, 
+			std::chrono::steady_clock::time_point end, std::thread::id threadID)
+		{
+			{
+				std::lock_guard lock(m_Mutex);
+				if (m_TimelineEnabled)
+					m_Timeline.push_back({ name, start, end, threadID });
+			}
+
+			WriteProfile({ name, FloatingPointMicroseconds{ start.time_since_epoch() }, end - start, threadID });
+		}
+
+		// Writes every recorded timeline event as a trace file, then clears and stops the timeline
+		void WriteTimeline(const std::string& filepath)
+		{
+			std::lock_guard lock(m_Mutex);
+			m_TimelineEnabled = false;
+			if (m_Timeline.empty())
+				return;
+
+			auto first = m_Timeline[0].Start, last = m_Timeline[0].End;
+			for (const TimelineEvent& event : m_Timeline)
+			{
+				first = std::min(first, event.Start);
+				last = std::max(last, event.End);
+			}
+
+			std::chrono::duration<double, std::milli> total = last - first;
+
+			std::ofstream out(filepath);
+			if (!out.is_open())
+			{
+				NB_ERROR("Instrumentor could not open timeline file '{0}'.", filepath);
+				return;
+			}
+
+			out << std::setprecision(3) << std::fixed;
+			out << "{\"otherData\": {\"totalMs\":" << total.count() << "},\"traceEvents\":[{}";
+			for (const TimelineEvent& event : m_Timeline)
+			{
+				out << ",{";
+				out << "\"cat\":\"timeline\",";
+				out << "\"dur\":" << FloatingPointMicroseconds{ event.End - event.Start }.count() << ',';
+				out << "\"name\":\"" << event.Name << "\",";
+				out << "\"ph\":\"X\",";
+				out << "\"pid\":0,";
+				out << "\"tid\":" << event.ThreadID << ",";
+				out << "\"ts\":" << FloatingPointMicroseconds{ event.Start - first }.count();
+				out << "}";
+			}
+			out << "]}";
+
+			NB_INFO("[Instrumentor] Timeline '{0}' took {1:.3f}ms", filepath, total.count());
+			m_Timeline.clear();
+		}
+
 		static Instrumentor& Get()
 		{
 			static Instrumentor instance;
@@ -132,6 +204,9 @@ namespace Nebula {
 		std::mutex m_Mutex;
 		InstrumentationSession* m_CurrentSession;
 		std::ofstream m_OutputStream;
+
+		std::vector<TimelineEvent> m_Timeline;
+		bool m_TimelineEnabled = false;
 	};
 
 	class InstrumentationTimer
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Maths.h"
+
+namespace Nebula {
+	// World space transform for 2D scenes: a 2x3 affine matrix plus depth.
+	// Everything is drawn in the XY plane, so this is exact for anything at local z = 0.
+	// X/Y rotation is folded into the 2x2 block; depth is carried through unscaled.
+	struct Affine2D {
+		glm::vec2 X = { 1.0f, 0.0f };			// First column
+		glm::vec2 Y = { 0.0f, 1.0f };			// Second column
+		glm::vec2 Translation = { 0.0f, 0.0f };
+		float Z = 0.0f;
+
+		Affine2D() = default;
+		Affine2D(const Affine2D&) = default;
+		Affine2D(const glm::vec2& x, const glm::vec2& y, const glm::vec2& translation, float z)
+			: X(x), Y(y), Translation(translation), Z(z) { }
+
+		static Affine2D FromTRS(const glm::vec3& translation, const glm::vec3& rotation, const glm::vec3& scale) {
+			glm::vec2 x, y;
+			if (rotation.x == 0.0f && rotation.y == 0.0f)
+			{
+				float c = cos(rotation.z), s = sin(rotation.z);
+				x = { c, s };
+				y = { -s, c };
+			}
+			else
+			{
+				// Tilted sprites: the projection of the 3D rotation onto the XY plane
+				glm::mat3 r = glm::toMat3(glm::quat(rotation));
+				x = glm::vec2(r[0]);
+				y = glm::vec2(r[1]);
+			}
+
+			return { x * scale.x, y * scale.y, glm::vec2(translation), translation.z };
+		}
+
+		Affine2D operator*(const Affine2D& other) const {
+			return {
+				X * other.X.x + Y * other.X.y,
+				X * other.Y.x + Y * other.Y.y,
+				X * other.Translation.x + Y * other.Translation.y + Translation,
+				Z + other.Z
+			};
+		}
+
+		glm::vec2 TransformPoint(const glm::vec2& point) const { return X * point.x + Y * point.y + Translation; }
+		glm::vec3 TransformPoint(const glm::vec3& point) const { return { TransformPoint(glm::vec2(point)), point.z + Z }; }
+
+		glm::vec3 GetTranslation() const { return { Translation, Z }; }
+		float GetRotation() const { return atan2(X.y, X.x); }
+		glm::vec2 GetScale() const {
+			float scaleX = length(X);
+			float determinant = X.x * Y.y - X.y * Y.x;
+			return { scaleX, scaleX != 0.0f ? determinant / scaleX : length(Y) };
+		}
+
+		// Closed form, rotation only has a z component
+		void Decompose(glm::vec3& outTranslation, glm::vec3& outRotation, glm::vec3& outScale) const {
+			outTranslation = GetTranslation();
+			outRotation = { 0.0f, 0.0f, GetRotation() };
+			outScale = { GetScale(), 1.0f };
+		}
+
+		// For the camera, renderer and anything else that needs a full matrix
+		glm::mat4 ToMat4() const {
+			return {
+				X.x, X.y, 0.0f, 0.0f,
+				Y.x, Y.y, 0.0f, 0.0f,
+				0.0f, 0.0f, 1.0f, 0.0f,
+				Translation.x, Translation.y, Z, 1.0f
+			};
+		}
+
+		operator glm::mat4() const { return ToMat4(); }
+	};
+}
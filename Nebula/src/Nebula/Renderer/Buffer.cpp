@@ -3,11 +3,12 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGl/OpenGL_Buffer.h"
+#include "Platform/Null/Null_Buffer.h"
 
 namespace Nebula {
 	Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
 		switch (Renderer::GetAPI()) {
-			case RendererAPI::API::None:		NB_ASSERT(false, "RendererAPI::None is not supported!"); return nullptr;
+			case RendererAPI::API::None:		return CreateRef<Null_VertexBuffer>();
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGL_VertexBuffer>(size);
 		}
 
@@ -17,7 +18,7 @@ namespace Nebula {
 
 	Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
 		switch (Renderer::GetAPI()) {
-			case RendererAPI::API::None:		NB_ASSERT(false, "RendererAPI::None is not supported!"); return nullptr;
+			case RendererAPI::API::None:		return CreateRef<Null_VertexBuffer>();
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGL_VertexBuffer>(vertices, size);
 		}
 
@@ -27,7 +28,7 @@ namespace Nebula {
 
 	Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
 		switch (Renderer::GetAPI()) {
-		case RendererAPI::API::None:		NB_ASSERT(false, "RendererAPI::None is not supported!"); return nullptr;
+		case RendererAPI::API::None:		return CreateRef<Null_IndexBuffer>(count);
 		case RendererAPI::API::OpenGL:		return CreateRef<OpenGL_IndexBuffer>(indices, count);
 		}
 
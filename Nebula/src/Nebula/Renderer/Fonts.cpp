@@ -14,29 +14,62 @@
 
 #include "Nebula/Project/Project.h"
 #include "Nebula/AssetManager/AssetManager.h"
+#include "Nebula/Core/JobSystem.h"
 
 namespace Nebula 
 {
+	// Returns the atlas pixels, the graphics API is not touched so fonts can be loaded on any thread
 	template<typename T, typename S, int N, msdf_atlas::GeneratorFunction<S, N> GenFunc>
-	static Ref<Texture2D> CreateAndCacheAtlas(const std::filesystem::path& cachePath, float fontSize, const std::vector<msdf_atlas::GlyphGeometry>& glyphs, 
-		msdf_atlas::FontGeometry fontGeometry, uint32_t width, uint32_t height)
+	static Buffer CreateAndCacheAtlas(const std::filesystem::path& cachePath, float fontSize, const std::vector<msdf_atlas::GlyphGeometry>& glyphs, 
+		msdf_atlas::FontGeometry fontGeometry, uint32_t width, uint32_t height, TextureSpecification& outSpec)
 	{
 		NB_PROFILE_FUNCTION();
 
-		Ref<Texture2D> texture = TextureImporter::CreateTexture2D(cachePath.string());
-		if (texture && texture->IsLoaded())
-			return texture;
+		if (std::filesystem::exists(cachePath))
+		{
+			Buffer cached = TextureImporter::LoadTexture2DData(cachePath.string(), outSpec);
+			if (cached)
+				return cached;
+		}
 	
 		msdf_atlas::GeneratorAttributes attributes;
 		attributes.config.overlapSupport = true;
 		attributes.scanlinePass = true;
 
-		msdf_atlas::ImmediateAtlasGenerator<S, N, GenFunc, msdf_atlas::BitmapAtlasStorage<T, N>> generator(width, height);
-		generator.setAttributes(attributes);
-		generator.setThreadCount(8);
-		generator.generate(glyphs.data(), (int)glyphs.size());
+		int maxBoxArea = 0;
+		for (const msdf_atlas::GlyphGeometry& glyph : glyphs)
+		{
+			int l, b, w, h;
+			glyph.getBoxRect(l, b, w, h);
+			maxBoxArea = std::max(maxBoxArea, w * h);
+		}
 
-		msdfgen::BitmapConstRef<T, N> bitmap = (msdfgen::BitmapConstRef<T, N>)generator.atlasStorage();
+		// What msdf_atlas::ImmediateAtlasGenerator does, on the job system instead of its own threads
+		msdf_atlas::BitmapAtlasStorage<T, N> storage(width, height);
+		JobSystem::ParallelFor((uint32_t)glyphs.size(), 16, [&](uint32_t begin, uint32_t end) {
+			std::vector<S> pixels((size_t)N * maxBoxArea);
+			std::vector<msdfgen::byte> errorCorrection(maxBoxArea);
+
+			msdf_atlas::GeneratorAttributes chunkAttributes = attributes;
+			chunkAttributes.config.errorCorrection.buffer = errorCorrection.data();
+
+			// Every glyph has its own box in the atlas, so chunks never write over each other
+			for (uint32_t i = begin; i < end; i++)
+			{
+				const msdf_atlas::GlyphGeometry& glyph = glyphs[i];
+				if (glyph.isWhitespace())
+					continue;
+
+				int l, b, w, h;
+				glyph.getBoxRect(l, b, w, h);
+
+				msdfgen::BitmapRef<S, N> glyphBitmap(pixels.data(), w, h);
+				GenFunc(glyphBitmap, glyph, chunkAttributes);
+				storage.put(l, b, msdfgen::BitmapConstRef<S, N>(glyphBitmap));
+			}
+		});
+
+		msdfgen::BitmapConstRef<T, N> bitmap = (msdfgen::BitmapConstRef<T, N>)storage;
 
 		if (!std::filesystem::exists(cachePath.parent_path()))
 			std::filesystem::create_directory(cachePath.parent_path());
@@ -44,18 +77,17 @@ namespace Nebula
 		stbi_flip_vertically_on_write(1);
 		stbi_write_png(cachePath.string().c_str(), bitmap.width, bitmap.height, N, (void*)bitmap.pixels, 0);
 
-		TextureSpecification spec;
-		spec.Width = bitmap.width;
-		spec.Height = bitmap.height;
-		spec.Format = ImageFormat::RGB8;
-		spec.GenerateMips = false;
+		outSpec.Width = bitmap.width;
+		outSpec.Height = bitmap.height;
+		outSpec.Format = ImageFormat::RGB8;
+		outSpec.GenerateMips = false;
 
-		texture = Texture2D::Create(spec);
-		texture->SetData(Buffer((void*)bitmap.pixels, bitmap.width * bitmap.height * 3));
-		return texture;
+		return Buffer::Copy(Buffer((void*)bitmap.pixels, bitmap.width * bitmap.height * 3));
 	}
 
-	Font::Font(const std::filesystem::path& filepath, std::filesystem::path cachePath)
+	static Ref<Font> s_DefaultFont;
+
+	Font::Font(const std::filesystem::path& filepath, std::filesystem::path cachePath, bool deferUpload)
 		: m_Data(CreateScope<MSDFData>()), m_Filename(filepath)
 	{
 		msdfgen::FreetypeHandle* ft = msdfgen::initializeFreetype();
@@ -104,17 +136,18 @@ namespace Nebula
 #define DEFAULT_ANGLE_THRESHOLD 3.0
 #define LCG_MULTIPLIER 6364136223846793005ull
 #define LCG_INCREMENT 1442695040888963407ull
-#define THREAD_COUNT 8
 
 		uint64_t coloringSeed = 0;
 		bool expensiveColoring = false;
 		if (expensiveColoring) 
 		{
-			msdf_atlas::Workload([&glyphs = m_Data->Glyphs, &coloringSeed](int i, int threadNo) -> bool {
-				unsigned long long glyphSeed = (LCG_MULTIPLIER * (coloringSeed ^ i) + LCG_INCREMENT) * !!coloringSeed;
-				glyphs[i].edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD, glyphSeed);
-				return true;
-			}, (int)m_Data->Glyphs.size()).finish(THREAD_COUNT);
+			JobSystem::ParallelFor((uint32_t)m_Data->Glyphs.size(), 16, [&glyphs = m_Data->Glyphs, &coloringSeed](uint32_t begin, uint32_t end) {
+				for (uint32_t i = begin; i < end; i++)
+				{
+					unsigned long long glyphSeed = (LCG_MULTIPLIER * (coloringSeed ^ i) + LCG_INCREMENT) * !!coloringSeed;
+					glyphs[i].edgeColoring(msdfgen::edgeColoringInkTrap, DEFAULT_ANGLE_THRESHOLD, glyphSeed);
+				}
+			});
 		}
 		else 
 		{
@@ -132,22 +165,113 @@ namespace Nebula
 			cachePath = "Resources/cache/font/" + filename.replace_extension().string() + ".png";
 		}
 		
-		m_AtlasTexture = CreateAndCacheAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(cachePath, (float)emSize, m_Data->Glyphs, m_Data->FontGeometry, width, height);
+		m_AtlasData = CreateAndCacheAtlas<uint8_t, float, 3, msdf_atlas::msdfGenerator>(cachePath, (float)emSize, m_Data->Glyphs, m_Data->FontGeometry, width, height, m_AtlasSpecification);
 
 		msdfgen::destroyFont(font);
 		msdfgen::deinitializeFreetype(ft);
+
+		if (!deferUpload)
+			UploadAtlas();
 	}
 
 	Font::~Font() 
 	{
+		m_AtlasData.Release();
+	}
+
+	void Font::UploadAtlas()
+	{
+		NB_PROFILE_FUNCTION();
+
+		if (!m_AtlasData)
+			return;
+
+		m_AtlasTexture = Texture2D::Create(m_AtlasSpecification, m_AtlasData);
+		m_AtlasData.Release();
+	}
+
+	glm::vec4 Font::GetStringBounds(const std::string& text, float kerning, float lineSpacing) const
+	{
+		NB_PROFILE_FUNCTION();
+
+		const auto& fontGeometry = m_Data->FontGeometry;
+		const auto& metrics = fontGeometry.getMetrics();
+
+		double x = 0.0, y = 0.0;
+		double fsScale = 1.0 / (metrics.ascenderY - metrics.descenderY);
+		const double spaceGlyphAdvance = fontGeometry.getGlyph(' ')->getAdvance();
+
+		glm::vec4 bounds = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+		for (uint32_t i = 0; i < text.length(); i++)
+		{
+			char character = text[i];
+			if (character == '\r')
+				continue;
+
+			if (character == '\n')
+			{
+				x = 0;
+				y -= fsScale * metrics.lineHeight + lineSpacing;
+				continue;
+			}
+
+			if (character == ' ')
+			{
+				double advance = spaceGlyphAdvance;
+				if (i < text.size() - 1)
+					fontGeometry.getAdvance(advance, character, text[i + 1]);
+
+				x += fsScale * advance;
+				continue;
+			}
+
+			if (character == '\t')
+			{
+				x += 4.0 * (fsScale * spaceGlyphAdvance);
+				continue;
+			}
+
+			auto glyph = fontGeometry.getGlyph(character);
+			if (!glyph)
+				glyph = fontGeometry.getGlyph('?');
+
+			if (!glyph)
+				continue;
+
+			double pl, pb, pr, pt;
+			glyph->getQuadPlaneBounds(pl, pb, pr, pt);
+
+			bounds.x = glm::min(bounds.x, (float)(x + pl * fsScale));
+			bounds.y = glm::min(bounds.y, (float)(y + pb * fsScale));
+			bounds.z = glm::max(bounds.z, (float)(x + pr * fsScale));
+			bounds.w = glm::max(bounds.w, (float)(y + pt * fsScale));
+
+			if (i < text.length() - 1)
+			{
+				double advance = glyph->getAdvance();
+				fontGeometry.getAdvance(advance, text[i], text[i + 1]);
+				x += fsScale * advance + kerning;
+			}
+		}
+
+		if (bounds.x > bounds.z)
+			return glm::vec4(0.0f);
+
+		return bounds;
+	}
+
+	void Font::LoadDefault(bool deferUpload)
+	{
+		s_DefaultFont = CreateRef<Font>("Resources/fonts/OpenSans/Regular.ttf", "Resources/cache/font/OpenSans_Regular.png", deferUpload);
 	}
 
 	Ref<Font> Font::GetDefault()
 	{
-		static Ref<Font> DefaultFont;
-		if (!DefaultFont)
-			DefaultFont = CreateRef<Font>("Resources/fonts/OpenSans/Regular.ttf", "Resources/cache/font/OpenSans_Regular.png");
+		if (!s_DefaultFont)
+			LoadDefault();
+		else if (!s_DefaultFont->GetAtlasTexture())
+			s_DefaultFont->UploadAtlas();
 
-		return DefaultFont;
+		return s_DefaultFont;
 	}
 }
\ No newline at end of file
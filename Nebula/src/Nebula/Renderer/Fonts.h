@@ -11,13 +11,20 @@ namespace Nebula {
 	class Font : public Asset
 	{
 	public:
-		Font(const std::filesystem::path& filename, std::filesystem::path cachePath = "");
+		// A deferred font only loads its atlas pixels, call UploadAtlas() on the main thread before rendering
+		Font(const std::filesystem::path& filename, std::filesystem::path cachePath = "", bool deferUpload = false);
 		~Font();
 
 		const MSDFData* GetMSDFData() const { return m_Data.get(); }
 		inline const Ref<Texture2D> GetAtlasTexture() const { return m_AtlasTexture; }
 		inline const std::filesystem::path& GetFilename() const { return m_Filename; }
+
+		// Returns the local space bounds of text as (min x, min y, max x, max y), matching Renderer2D::DrawString
+		glm::vec4 GetStringBounds(const std::string& text, float kerning = 0.0f, float lineSpacing = 0.0f) const;
+
+		void UploadAtlas();
 		
+		static void LoadDefault(bool deferUpload = false);
 		static Ref<Font> GetDefault();
 
 		static AssetType GetStaticType() { return AssetType::Font; }
@@ -26,6 +33,9 @@ namespace Nebula {
 		std::filesystem::path m_Filename;
 		Scope<MSDFData> m_Data;
 		Ref<Texture2D> m_AtlasTexture;
+
+		Buffer m_AtlasData;
+		TextureSpecification m_AtlasSpecification;
 	};
 
 	class FontFamily : public Asset
@@ -3,6 +3,7 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGl/OpenGL_FrameBuffer.h"
+#include "Platform/OpenGl/OpenGL_RenderTargetPool.h"
 
 namespace Nebula {
 	Ref<FrameBuffer> FrameBuffer::Create(const FrameBufferSpecification& specifications) {
@@ -14,4 +15,23 @@ namespace Nebula {
 		NB_ASSERT(false, "Unknown Renderer API!");
 		return nullptr;
 	}
-}
+
+	FrameBufferPoolStats FrameBuffer::GetPoolStats() {
+		switch (Renderer::GetAPI()) {
+			case RendererAPI::API::None:	return {};
+			case RendererAPI::API::OpenGL:  return OpenGL_RenderTargetPool::GetStats();
+		}
+
+		NB_ASSERT(false, "Unknown Renderer API!");
+		return {};
+	}
+
+	void FrameBuffer::TrimPool() {
+		switch (Renderer::GetAPI()) {
+			case RendererAPI::API::None:	return;
+			case RendererAPI::API::OpenGL:  OpenGL_RenderTargetPool::Trim(); return;
+		}
+
+		NB_ASSERT(false, "Unknown Renderer API!");
+	}
+}
\ No newline at end of file
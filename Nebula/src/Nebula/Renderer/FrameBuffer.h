@@ -2,6 +2,7 @@
 
 #include "Nebula/Core/API.h"
 #include "Nebula/Utils/Arrays.h"
+#include "Nebula/Maths/Maths.h"
 
 namespace Nebula {
 	enum class FramebufferTextureFormat {
@@ -42,6 +43,14 @@ namespace Nebula {
 		bool SwapChainTarget = false;
 	};
 
+	struct FrameBufferPoolStats {
+		uint32_t Hits = 0;
+		uint32_t Misses = 0;
+
+		uint32_t TexturesAllocated = 0;
+		uint64_t BytesAllocated = 0;
+	};
+
 	class FrameBuffer {
 	public:
 		virtual ~FrameBuffer() = default;
@@ -52,13 +61,23 @@ namespace Nebula {
 		virtual void Resize(uint32_t width, uint32_t height) = 0;
 		virtual int ReadPixel(uint32_t attachmentIndex, int x, int y) = 0;
 
+		// Non-blocking alternative to ReadPixel, the result of a request is returned one frame later
+		virtual void RequestPixel(uint32_t attachmentIndex, int x, int y) = 0;
+		virtual int GetRequestedPixel() const = 0;
+
 		virtual void ClearAttachment(uint32_t attachmentIndex, int value) = 0;
 
 		virtual uint32_t GetColourAttachmentRendererID(uint32_t index = 0) const = 0;
 
+		// Attachments are pooled in size buckets, so only part of each texture is rendered to
+		virtual glm::vec2 GetAttachmentUV() const = 0;
+
 		virtual FrameBufferSpecification& GetFrameBufferSpecifications() = 0;
 		virtual const FrameBufferSpecification& GetFrameBufferSpecifications() const = 0;
 
 		static Ref<FrameBuffer> Create(const FrameBufferSpecification& specifications);
+		static FrameBufferPoolStats GetPoolStats();
+		// Frees pooled attachments no framebuffer has used for a while, called once per frame
+		static void TrimPool();
 	};
 }
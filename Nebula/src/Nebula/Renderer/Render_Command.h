@@ -6,6 +6,7 @@ namespace Nebula {
 	class RenderCommand {
 	public:
 		inline static void Init() {
+			s_RendererAPI = RendererAPI::Create();
 			s_RendererAPI->Init();
 		}
 
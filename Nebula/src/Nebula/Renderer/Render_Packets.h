@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Utils/Arrays.h"
+#include "Nebula/Maths/Maths.h"
+
+#include "Texture.h"
+#include "Fonts.h"
+
+namespace Nebula {
+	// Render data copied out of a scene once its update has finished, so drawing never reads components
+
+	struct SpritePacket
+	{
+		glm::mat4 Transform;
+		glm::vec4 Colour;
+		// Min (x, y) and max (z, w) texture coordinates
+		glm::vec4 UVRect;
+		// Null draws the white texture
+		Ref<Texture2D> Texture;
+		float Tiling;
+		float Depth;
+		uint32_t EntityID;
+	};
+
+	struct CirclePacket
+	{
+		glm::mat4 Transform;
+		glm::vec4 Colour;
+		float Thickness, Fade;
+		float Depth;
+		uint32_t EntityID;
+	};
+
+	struct StringPacket
+	{
+		glm::mat4 Transform;
+		std::string Text;
+		Ref<Font> Font;
+		glm::vec4 Colour;
+		float Kerning, LineSpacing;
+		uint32_t EntityID;
+	};
+
+	// One frame's packets. Buffers are reused, so the arrays keep their capacity between frames
+	struct RenderPacketBuffer
+	{
+		bool HasCamera = false;
+		glm::mat4 CameraProjection = glm::mat4(1.0f);
+		glm::mat4 CameraTransform = glm::mat4(1.0f);
+
+		// Back to front
+		Array<SpritePacket> Sprites;
+		Array<CirclePacket> Circles;
+		Array<StringPacket> Strings;
+	};
+}
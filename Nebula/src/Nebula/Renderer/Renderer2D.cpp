@@ -25,13 +25,19 @@ namespace Nebula {
 		int EntityID;
 	};
 
-	struct CircleVertex
+	struct ShapeVertex
 	{
 		glm::vec3 Position;
-		glm::vec3 LocalPosition;
+		glm::vec2 LocalPosition;
 		glm::vec4 Colour;
-		float Thickness;
-		float Fade;
+		glm::vec2 TexCoord;
+		float TexIndex;
+		float TilingFactor;
+
+		// Selects the distance function in Shape.glsl
+		float Shape;
+		// Circles: thickness, fade. Rounded rects: radius, fade, half size
+		glm::vec4 ShapeParams;
 
 		//Editor Only
 		int EntityID;
@@ -64,7 +70,7 @@ namespace Nebula {
 		static const uint32_t MaxIndices   = MaxSprites * 6;
 		
 		Ref<Shader>		TextureShader;
-		Ref<Shader>		 CircleShader;
+		Ref<Shader>		  ShapeShader;
 		Ref<Shader>		   LineShader;
 		Ref<Shader>		   TextShader;
 		Ref<Texture2D>	 WhiteTexture;
@@ -79,16 +85,18 @@ namespace Nebula {
 		CameraData CameraBuffer;
 		Ref<UniformBuffer> CameraUniformBuffer;
 
-		//Quad
-		Ref<VertexArray>	   QuadVertexArray;
-		Ref<VertexBuffer>	  QuadVertexBuffer;
+		Renderer2D::Statistics Stats;
+
+		//Shapes (Quads, Circles, Rounded Rects)
+		Ref<VertexArray>	  ShapeVertexArray;
+		Ref<VertexBuffer>	 ShapeVertexBuffer;
 		
 		glm::vec4* QuadVertexPos = new glm::vec4[4];
 		glm::vec2* QuadTexCoords = new glm::vec2[4];
-		uint32_t QuadIndexCount = 0;
+		uint32_t ShapeIndexCount = 0;
 		
-		Vertex* QuadVBBase = nullptr;
-		Vertex* QuadVBPtr  = nullptr;
+		ShapeVertex* ShapeVBBase = nullptr;
+		ShapeVertex* ShapeVBPtr  = nullptr;
 
 		//Tri
 		Ref<VertexArray>   TriangleVertexArray;
@@ -101,15 +109,6 @@ namespace Nebula {
 		Vertex* TriVBBase = nullptr;
 		Vertex* TriVBPtr  = nullptr; 
 
-		//Circle
-		Ref<VertexArray>	CircleVertexArray;
-		Ref<VertexBuffer>  CircleVertexBuffer;
-
-		uint32_t CircleIndexCount = 0;
-
-		CircleVertex* CircleVBBase = nullptr;
-		CircleVertex* CircleVBPtr  = nullptr;
-
 		//Line
 		Ref<VertexArray>	LineVertexArray;
 		Ref<VertexBuffer>  LineVertexBuffer;
@@ -137,7 +136,7 @@ namespace Nebula {
 	static void SetupShape(const uint32_t Type, BufferLayout layout, uint32_t maxVertices, uint32_t maxIndices, 
 		uint32_t indicesPerShape, uint32_t verticesPerShape) {
 		Ref<VertexArray> vArray  = VertexArray::Create();
-		Ref<VertexBuffer> vBuffer = VertexBuffer::Create(maxVertices * sizeof(Vertex));
+		Ref<VertexBuffer> vBuffer = VertexBuffer::Create(maxVertices * layout.GetStride());
 		vBuffer->SetLayout(layout);
 		vArray->AddVertexBuffer(vBuffer); 
 		
@@ -165,17 +164,13 @@ namespace Nebula {
 		delete[] indices;
 
 		if (Type == NB_QUAD) {
-			s_Data.QuadVertexArray = vArray;
-			s_Data.QuadVertexBuffer = vBuffer;
-			s_Data.QuadVBBase = new Vertex[s_Data.MaxVertices];
+			s_Data.ShapeVertexArray = vArray;
+			s_Data.ShapeVertexBuffer = vBuffer;
+			s_Data.ShapeVBBase = new ShapeVertex[s_Data.MaxVertices];
 		} else if (Type == NB_TRI) {
 			s_Data.TriangleVertexArray = vArray;
 			s_Data.TriangleVertexBuffer = vBuffer;
 			s_Data.TriVBBase = new Vertex[s_Data.MaxVertices];
-		} else if (Type == NB_CIRCLE) {
-			s_Data.CircleVertexArray = vArray;
-			s_Data.CircleVertexBuffer = vBuffer;
-			s_Data.CircleVBBase = new CircleVertex[s_Data.MaxVertices];
 		} else if (Type == NB_LINE) { 
 			s_Data.LineVertexArray = vArray;
 			s_Data.LineVertexBuffer = vBuffer;
@@ -191,15 +186,12 @@ namespace Nebula {
 	static void ResetBatch() {
 		NB_PROFILE_FUNCTION();
 
-		s_Data.QuadIndexCount = 0;
-		s_Data.QuadVBPtr = s_Data.QuadVBBase;
+		s_Data.ShapeIndexCount = 0;
+		s_Data.ShapeVBPtr = s_Data.ShapeVBBase;
 
 		s_Data.TriIndexCount = 0;
 		s_Data.TriVBPtr = s_Data.TriVBBase;
 
-		s_Data.CircleIndexCount = 0;
-		s_Data.CircleVBPtr = s_Data.CircleVBBase;
-
 		s_Data.LineVertexCount = 0;
 		s_Data.LineVBPtr = s_Data.LineVBBase;
 
@@ -221,12 +213,15 @@ namespace Nebula {
 			{ShaderDataType::Int, "entityID"}
 		};
 
-		BufferLayout CircleLayout = {
+		BufferLayout ShapeLayout = {
 			{ShaderDataType::Float3, "position"},
-			{ShaderDataType::Float3, "localPosition"},
+			{ShaderDataType::Float2, "localPosition"},
 			{ShaderDataType::Float4, "colour"},
-			{ShaderDataType::Float, "thickness"},
-			{ShaderDataType::Float, "fade"},
+			{ShaderDataType::Float2, "texCoord"},
+			{ShaderDataType::Float, "texIndex"},
+			{ShaderDataType::Float, "tilingFactor"},
+			{ShaderDataType::Float, "shape"},
+			{ShaderDataType::Float4, "shapeParams"},
 			{ShaderDataType::Int, "entityID"}
 		};
 
@@ -243,9 +238,8 @@ namespace Nebula {
 			{ShaderDataType::Int, "entityID"}
 		};
 
-		SetupShape(NB_QUAD, layout, s_Data.MaxVertices, s_Data.MaxIndices, 6, 4);
+		SetupShape(NB_QUAD, ShapeLayout, s_Data.MaxVertices, s_Data.MaxIndices, 6, 4);
 		SetupShape(NB_TRI, layout, s_Data.MaxVertices, s_Data.MaxIndices, 3, 3);
-		SetupShape(NB_CIRCLE, CircleLayout, s_Data.MaxVertices, s_Data.MaxIndices, 6, 4);
 		SetupShape(NB_LINE, LineLayout, s_Data.MaxVertices, s_Data.MaxIndices, 2, 2);
 		SetupShape(NB_STRING, Textlayout, s_Data.MaxVertices, s_Data.MaxIndices, 6, 4);
 
@@ -277,10 +271,19 @@ namespace Nebula {
 		s_Data.TextureSlots[0] = s_Data.WhiteTexture;
 
 		//Shaders
-		s_Data.TextureShader = Shader::Create("Resources/shaders/Default.glsl");
-		s_Data.CircleShader = Shader::Create("Resources/shaders/Circle.glsl");
-		s_Data.LineShader = Shader::Create("Resources/shaders/Line.glsl");
-		s_Data.TextShader = Shader::Create("Resources/shaders/Text.glsl");
+		Array<std::string> shaderPaths = { {
+			"Resources/shaders/Default.glsl",
+			"Resources/shaders/Shape.glsl",
+			"Resources/shaders/Line.glsl",
+			"Resources/shaders/Text.glsl"
+		} };
+
+		Array<Ref<Shader>> shaders = Shader::Create(shaderPaths);
+
+		s_Data.TextureShader = shaders[0];
+		s_Data.ShapeShader = shaders[1];
+		s_Data.LineShader = shaders[2];
+		s_Data.TextShader = shaders[3];
 		
 		int32_t samplers[s_Data.MaxTextureSlots];
 		for (uint32_t i = 0; i < s_Data.MaxTextureSlots; i++)
@@ -288,6 +291,8 @@ namespace Nebula {
 
 		s_Data.TextureShader->Bind();
 		s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
+		s_Data.ShapeShader->Bind();
+		s_Data.ShapeShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
 		
 		//Camera Uniform
 		s_Data.CameraUniformBuffer = UniformBuffer::Create(sizeof(Renderer2DData::CameraData), 0);
@@ -296,9 +301,8 @@ namespace Nebula {
 	void Renderer2D::Shutdown() {
 		NB_PROFILE_FUNCTION();
 
-		delete[] s_Data.QuadVBBase;
+		delete[] s_Data.ShapeVBBase;
 		delete[] s_Data.TriVBBase;
-		delete[] s_Data.CircleVBBase;
 		delete[] s_Data.LineVBBase;
 		delete[] s_Data.TextVBBase;
 
@@ -441,6 +445,7 @@ namespace Nebula {
 			s_Data.TextVBPtr++;
 
 			s_Data.TextIndexCount += 6;
+			s_Data.Stats.CharacterCount++;
 
 			if (i < text.length() - 1)
 			{
@@ -473,50 +478,92 @@ namespace Nebula {
 		}
 
 		s_Data.TriIndexCount += vertexCount;
+		s_Data.Stats.TriangleCount += vertexCount / 3;
 	}
 
 	void Renderer2D::DrawQuad(const uint32_t vertexCount, const glm::vec4* vertexPos, glm::vec2* texCoords,
 		const glm::mat4& transform, const glm::vec4& colour, Ref<Texture2D> texture, float tiling, uint32_t entityID)
 	{
 		NB_PROFILE_FUNCTION();
-		if (s_Data.QuadIndexCount >= s_Data.MaxIndices)
+		if (s_Data.ShapeIndexCount >= s_Data.MaxIndices)
 			FlushAndReset();
 
 		float textureIndex = GetTextureIndex(texture ? texture : s_Data.WhiteTexture);
 
 		for (size_t i = 0; i < vertexCount; i++)
 		{
-			s_Data.QuadVBPtr->Position = transform * vertexPos[i];
-			s_Data.QuadVBPtr->Colour = colour;
-			s_Data.QuadVBPtr->TexCoord = texCoords[i];
-			s_Data.QuadVBPtr->TexIndex = textureIndex;
-			s_Data.QuadVBPtr->TilingFactor = tiling;
-			s_Data.QuadVBPtr->EntityID = entityID;
-			s_Data.QuadVBPtr++;
+			s_Data.ShapeVBPtr->Position = transform * vertexPos[i];
+			s_Data.ShapeVBPtr->LocalPosition = glm::vec2(0.0f);
+			s_Data.ShapeVBPtr->Colour = colour;
+			s_Data.ShapeVBPtr->TexCoord = texCoords[i];
+			s_Data.ShapeVBPtr->TexIndex = textureIndex;
+			s_Data.ShapeVBPtr->TilingFactor = tiling;
+			s_Data.ShapeVBPtr->Shape = (float)ShapeType::Quad;
+			s_Data.ShapeVBPtr->ShapeParams = glm::vec4(0.0f);
+			s_Data.ShapeVBPtr->EntityID = entityID;
+			s_Data.ShapeVBPtr++;
 		}
 
-		s_Data.QuadIndexCount += uint32_t(vertexCount * 1.5);
+		s_Data.ShapeIndexCount += uint32_t(vertexCount * 1.5);
+		s_Data.Stats.QuadCount += vertexCount / 4;
 	}
 
 	void Renderer2D::DrawCircle(const glm::mat4& transform, const glm::vec4& colour, const float thickness, const float fade, uint32_t entityID) 
 	{
 		NB_PROFILE_FUNCTION();
 
-		if (s_Data.CircleIndexCount >= s_Data.MaxIndices)
+		if (s_Data.ShapeIndexCount >= s_Data.MaxIndices)
+			FlushAndReset();
+
+		for (size_t i = 0; i < 4; i++)
+		{
+			s_Data.ShapeVBPtr->Position = transform * s_Data.QuadVertexPos[i];
+			s_Data.ShapeVBPtr->LocalPosition = s_Data.QuadVertexPos[i] * 2.0f;
+			s_Data.ShapeVBPtr->Colour = colour;
+			s_Data.ShapeVBPtr->TexCoord = s_Data.QuadTexCoords[i];
+			s_Data.ShapeVBPtr->TexIndex = 0.0f;
+			s_Data.ShapeVBPtr->TilingFactor = 1.0f;
+			s_Data.ShapeVBPtr->Shape = (float)ShapeType::Circle;
+			s_Data.ShapeVBPtr->ShapeParams = glm::vec4(thickness, fade, 0.0f, 0.0f);
+			s_Data.ShapeVBPtr->EntityID = entityID;
+			s_Data.ShapeVBPtr++;
+		}
+
+		s_Data.ShapeIndexCount += 6;
+		s_Data.Stats.CircleCount++;
+	}
+
+	void Renderer2D::DrawRoundedRect(const glm::mat4& transform, const glm::vec4& colour, float radius, Ref<Texture2D> texture, 
+		float tiling, const float fade, uint32_t entityID)
+	{
+		NB_PROFILE_FUNCTION();
+
+		if (s_Data.ShapeIndexCount >= s_Data.MaxIndices)
 			FlushAndReset();
 
+		float textureIndex = GetTextureIndex(texture ? texture : s_Data.WhiteTexture);
+
+		// Distances are measured in world units so corners stay round on stretched rects
+		glm::vec2 size = { glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])) };
+		glm::vec2 halfSize = size * 0.5f;
+		radius = glm::clamp(radius, 0.0f, glm::min(halfSize.x, halfSize.y));
+
 		for (size_t i = 0; i < 4; i++)
 		{
-			s_Data.CircleVBPtr->Position = transform * s_Data.QuadVertexPos[i];
-			s_Data.CircleVBPtr->LocalPosition = s_Data.QuadVertexPos[i] * 2.0f;
-			s_Data.CircleVBPtr->Colour = colour;
-			s_Data.CircleVBPtr->Thickness = thickness;
-			s_Data.CircleVBPtr->Fade = fade;
-			s_Data.CircleVBPtr->EntityID = entityID;
-			s_Data.CircleVBPtr++;
+			s_Data.ShapeVBPtr->Position = transform * s_Data.QuadVertexPos[i];
+			s_Data.ShapeVBPtr->LocalPosition = glm::vec2(s_Data.QuadVertexPos[i]) * size;
+			s_Data.ShapeVBPtr->Colour = colour;
+			s_Data.ShapeVBPtr->TexCoord = s_Data.QuadTexCoords[i];
+			s_Data.ShapeVBPtr->TexIndex = textureIndex;
+			s_Data.ShapeVBPtr->TilingFactor = tiling;
+			s_Data.ShapeVBPtr->Shape = (float)ShapeType::RoundedRect;
+			s_Data.ShapeVBPtr->ShapeParams = glm::vec4(radius, fade, halfSize.x, halfSize.y);
+			s_Data.ShapeVBPtr->EntityID = entityID;
+			s_Data.ShapeVBPtr++;
 		}
 
-		s_Data.CircleIndexCount += 6;
+		s_Data.ShapeIndexCount += 6;
+		s_Data.Stats.QuadCount++;
 	}
 
 	void Renderer2D::DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& colour, int entityID) 
@@ -532,13 +579,14 @@ namespace Nebula {
 		s_Data.LineVBPtr++;
 
 		s_Data.LineVertexCount += 2;
+		s_Data.Stats.LineCount++;
 	}
 
 	void Renderer2D::Draw(const uint32_t type, Entity& entity) 
 	{
 		NB_PROFILE_FUNCTION();
 
-		glm::mat4 transform = entity.GetComponent<WorldTransformComponent>().Transform;
+		glm::mat4 transform = entity.GetComponent<WorldTransformComponent>().Transform.ToMat4();
 		switch (type)
 		{
 		case NB_RECT: {
@@ -599,6 +647,26 @@ namespace Nebula {
 		}
 	}
 
+	void Renderer2D::Draw(const SpritePacket& sprite)
+	{
+		const glm::vec4& uv = sprite.UVRect;
+		glm::vec2 texCoords[4] = { { uv.x, uv.y }, { uv.z, uv.y }, { uv.z, uv.w }, { uv.x, uv.w } };
+
+		DrawQuad(4, s_Data.QuadVertexPos, texCoords, sprite.Transform, sprite.Colour, 
+			sprite.Texture ? sprite.Texture : s_Data.WhiteTexture, sprite.Tiling, sprite.EntityID);
+	}
+
+	void Renderer2D::Draw(const CirclePacket& circle)
+	{
+		DrawCircle(circle.Transform, circle.Colour, circle.Thickness, circle.Fade, circle.EntityID);
+	}
+
+	void Renderer2D::Draw(const StringPacket& text)
+	{
+		TextParams params = { text.Colour, text.Kerning, text.LineSpacing };
+		DrawString(text.Text, text.Font, text.Transform, params, text.EntityID);
+	}
+
 	void Renderer2D::Draw(const uint32_t type, const glm::mat4& transform, const glm::vec4& colour, Ref<Texture2D> texture, float tiling) {
 		switch (type) {
 		case NB_RECT: {
@@ -696,9 +764,7 @@ namespace Nebula {
 	void Renderer2D::EndScene() {
 		NB_PROFILE_FUNCTION();
 		
-		if (s_Data.QuadIndexCount || s_Data.TriIndexCount) {
-			s_Data.TextureShader->Bind();
-		
+		if (s_Data.ShapeIndexCount || s_Data.TriIndexCount) {
 			for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
 				s_Data.TextureSlots[i]->Bind(i);
 		}
@@ -707,22 +773,19 @@ namespace Nebula {
 			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.TriVBPtr - (uint8_t*)s_Data.TriVBBase);
 			s_Data.TriangleVertexBuffer->SetData(s_Data.TriVBBase, dataSize);
 			
+			s_Data.TextureShader->Bind();
 			RenderCommand::DrawIndexed(s_Data.TriangleVertexArray, s_Data.TriIndexCount);
+			s_Data.Stats.DrawCalls++;
 		}
 
-		if (s_Data.QuadIndexCount) {
-			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVBPtr - (uint8_t*)s_Data.QuadVBBase);
-			s_Data.QuadVertexBuffer->SetData(s_Data.QuadVBBase, dataSize);
+		// Quads, circles and rounded rects share one draw
+		if (s_Data.ShapeIndexCount) {
+			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.ShapeVBPtr - (uint8_t*)s_Data.ShapeVBBase);
+			s_Data.ShapeVertexBuffer->SetData(s_Data.ShapeVBBase, dataSize);
 
-			RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
-		}
-		
-		if (s_Data.CircleIndexCount) {
-			uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.CircleVBPtr - (uint8_t*)s_Data.CircleVBBase);
-			s_Data.CircleVertexBuffer->SetData(s_Data.CircleVBBase, dataSize);
-			
-			s_Data.CircleShader->Bind();
-			RenderCommand::DrawIndexed(s_Data.CircleVertexArray, s_Data.CircleIndexCount);
+			s_Data.ShapeShader->Bind();
+			RenderCommand::DrawIndexed(s_Data.ShapeVertexArray, s_Data.ShapeIndexCount);
+			s_Data.Stats.DrawCalls++;
 		}
 
 		if (s_Data.LineVertexCount) {
@@ -731,6 +794,7 @@ namespace Nebula {
 
 			s_Data.LineShader->Bind();
 			RenderCommand::DrawLines(s_Data.LineVertexArray, s_Data.LineVertexCount);
+			s_Data.Stats.DrawCalls++;
 		}
 
 		if (s_Data.TextIndexCount) {
@@ -741,9 +805,18 @@ namespace Nebula {
 			s_Data.FontAtlasTexture->Bind();
 
 			RenderCommand::DrawIndexed(s_Data.TextVertexArray, s_Data.TextIndexCount);
+			s_Data.Stats.DrawCalls++;
 		}
 	}
 
+	Renderer2D::Statistics Renderer2D::GetStats() {
+		return s_Data.Stats;
+	}
+
+	void Renderer2D::ResetStats() {
+		s_Data.Stats = Statistics();
+	}
+
 	void Renderer2D::FlushAndReset() {
 		EndScene();
 		ResetBatch();
@@ -3,6 +3,7 @@
 #include "Camera.h"
 #include "Texture.h"
 #include "Fonts.h"
+#include "Render_Packets.h"
 
 #include "Nebula/Scene/Entity.h"
 
@@ -18,7 +19,7 @@ namespace Nebula {
 	class VertexBuffer;
 
 	struct Vertex;
-	struct CircleVertex;
+	struct ShapeVertex;
 	
 	class Renderer2D 
 	{
@@ -26,6 +27,9 @@ namespace Nebula {
 		static void Init();
 		static void Shutdown();
 
+		// Quads, circles and rounded rects are drawn by one uber-shader, selected per vertex
+		enum class ShapeType { Quad = 0, Circle = 1, RoundedRect = 2 };
+
 		static void BeginScene(const Camera& camera, const glm::mat4& transform = glm::mat4(1.0f));
 		static void BeginScene(const EditorCamera& camera);
 		static void EndScene();
@@ -35,6 +39,10 @@ namespace Nebula {
 		static void Draw(const uint32_t type, const glm::vec4* vertexPos, glm::vec2* texCoords,
 			const glm::mat4& transform, const glm::vec4& colour, Ref<Texture2D> texture, float tiling);
 
+		static void Draw(const SpritePacket& sprite);
+		static void Draw(const CirclePacket& circle);
+		static void Draw(const StringPacket& text);
+
 		//Primitives
 
 		struct TextParams
@@ -50,7 +58,21 @@ namespace Nebula {
 		static void DrawQuad(const uint32_t vertexCount, const glm::vec4* vertexPos, glm::vec2* texCoords,
 			const glm::mat4& transform, const glm::vec4& colour, Ref<Texture2D> texture = nullptr, float tiling = 1.0f, uint32_t entityID = -1);
 		static void DrawCircle(const glm::mat4& transform, const glm::vec4& colour, const float thickness = 1.0f, const float fade = 0.005f, uint32_t entityID = -1);
+		static void DrawRoundedRect(const glm::mat4& transform, const glm::vec4& colour, float radius, Ref<Texture2D> texture = nullptr, 
+			float tiling = 1.0f, const float fade = 0.005f, uint32_t entityID = -1);
 		static void DrawLine(const glm::vec3& p0, const glm::vec3& p1, const glm::vec4& colour, int entityID = -1);
+
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t QuadCount = 0;
+			uint32_t CircleCount = 0;
+			uint32_t TriangleCount = 0;
+			uint32_t LineCount = 0;
+			uint32_t CharacterCount = 0;
+		};
+		static Statistics GetStats();
+		static void ResetStats();
 	private:
 		static void FlushAndReset();
 		static float GetTextureIndex(const Ref<Texture2D>& texture);
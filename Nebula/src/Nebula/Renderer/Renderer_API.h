@@ -27,6 +27,8 @@ namespace Nebula {
 		virtual void SetLineWidth(float width) = 0;
 
 		inline static API GetAPI() { return s_API; }
+		// Must be set before Renderer::Init(). API::None runs the renderer without a GPU
+		inline static void SetAPI(API api) { s_API = api; }
 		static Scope<RendererAPI> Create();
 	private:
 		static API s_API;
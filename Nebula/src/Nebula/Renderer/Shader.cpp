@@ -3,11 +3,12 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGl/OpenGL_Shader.h"
+#include "Platform/Null/Null_Shader.h"
 
 namespace Nebula {
 	Ref<Shader> Shader::Create(const std::string& path) {
 		switch (Renderer::GetAPI()) {
-		case RendererAPI::API::None:	NB_ASSERT(false, "RendererAPI::None is currently not supported!");
+		case RendererAPI::API::None:	return CreateRef<Null_Shader>(std::filesystem::path(path).stem().string());
 		case RendererAPI::API::OpenGL:	return CreateRef<OpenGL_Shader>(path);
 		}
 
@@ -17,7 +18,7 @@ namespace Nebula {
 
 	Ref<Shader> Shader::Create(const std::string& name, const std::string& vertSrc, const std::string& fragSrc) {
 		switch (Renderer::GetAPI()) {
-			case RendererAPI::API::None:	NB_ASSERT(false, "RendererAPI::None is currently not supported!");
+			case RendererAPI::API::None:	return CreateRef<Null_Shader>(name);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGL_Shader>(name, vertSrc, fragSrc);
 		}
 
@@ -25,6 +26,22 @@ namespace Nebula {
 		return nullptr;
 	}
 
+	Array<Ref<Shader>> Shader::Create(const Array<std::string>& paths) {
+		switch (Renderer::GetAPI()) {
+			case RendererAPI::API::None: {
+				Array<Ref<Shader>> shaders;
+				for (const std::string& path : paths)
+					shaders.push_back(CreateRef<Null_Shader>(std::filesystem::path(path).stem().string()));
+
+				return shaders;
+			}
+			case RendererAPI::API::OpenGL:	return OpenGL_Shader::Create(paths);
+		}
+
+		NB_ASSERT(false, "Unknown RendererAPI!");
+		return {};
+	}
+
 	void ShaderLibrary::Add(const std::string& name, const Ref<Shader>& shader) {
 		NB_ASSERT(m_Shaders.find(name) == m_Shaders.end(), "Shader already exists!");
 		m_Shaders[name] = shader;
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Nebula/Maths/Maths.h"
+#include "Nebula/Utils/Arrays.h"
 
 namespace Nebula {
 	class Shader {
@@ -16,6 +17,7 @@ namespace Nebula {
 
 		static Ref<Shader> Create(const std::string& path);
 		static Ref<Shader> Create(const std::string& name, const std::string& vertSrc, const std::string& fragSrc);
+		static Array<Ref<Shader>> Create(const Array<std::string>& paths);
 
 		virtual void SetInt(const std::string& name, const int value) = 0;
 		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
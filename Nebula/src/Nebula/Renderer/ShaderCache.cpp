@@ -0,0 +1,212 @@
+#include "nbpch.h"
+#include "ShaderCache.h"
+
+#include "Nebula/Utils/YAML.h"
+
+#include <fstream>
+#include <mutex>
+
+namespace Nebula {
+	struct ShaderCacheData {
+		std::filesystem::path CacheDirectory = "Resources/cache/shader/opengl";
+		std::unordered_map<std::string, ShaderCache::ProgramEntry> Programs;
+		bool ManifestLoaded = false;
+
+		// Shaders are compiled on worker threads
+		std::mutex Mutex;
+	};
+
+	static ShaderCacheData s_Data;
+
+	namespace Utils {
+		static std::filesystem::path GetManifestPath() {
+			return s_Data.CacheDirectory / "manifest.yaml";
+		}
+	}
+
+	uint64_t ShaderCache::Hash(const void* data, size_t size, uint64_t seed) {
+		// FNV-1a
+		const uint8_t* bytes = (const uint8_t*)data;
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; i++) {
+			hash ^= bytes[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	uint64_t ShaderCache::Combine(uint64_t seed, uint64_t value) {
+		return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+	}
+
+	std::string ShaderCache::KeyToString(uint64_t key) {
+		char buffer[17];
+		snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)key);
+		return buffer;
+	}
+
+	void ShaderCache::SetCacheDirectory(const std::filesystem::path& directory) {
+		std::scoped_lock lock(s_Data.Mutex);
+
+		s_Data.CacheDirectory = directory;
+		s_Data.Programs.clear();
+		s_Data.ManifestLoaded = false;
+	}
+
+	const std::filesystem::path& ShaderCache::GetCacheDirectory() {
+		return s_Data.CacheDirectory;
+	}
+
+	std::filesystem::path ShaderCache::GetCachePath(uint64_t key, std::string_view extension) {
+		return s_Data.CacheDirectory / (KeyToString(key) + std::string(extension));
+	}
+
+	void ShaderCache::DiscardBinary(const std::filesystem::path& path) {
+		NB_WARN("[ShaderCache] Discarding corrupt cache file '{0}'", path.string());
+
+		std::error_code error;
+		std::filesystem::remove(path, error);
+	}
+
+	bool ShaderCache::ReadBinary(const std::filesystem::path& path, std::vector<uint32_t>& outData) {
+		std::ifstream in(path, std::ios::in | std::ios::binary);
+		if (!in.is_open())
+			return false;
+
+		in.seekg(0, std::ios::end);
+		auto size = in.tellg();
+		in.seekg(0, std::ios::beg);
+
+		// SPIR-V is made of whole words, anything else was cut short or isn't ours
+		if (size <= 0 || (size_t)size % sizeof(uint32_t) != 0)
+		{
+			in.close();
+			DiscardBinary(path);
+			return false;
+		}
+
+		outData.resize((size_t)size / sizeof(uint32_t));
+		if (!in.read((char*)outData.data(), outData.size() * sizeof(uint32_t)))
+		{
+			outData.clear();
+			in.close();
+			DiscardBinary(path);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ShaderCache::WriteBinary(const std::filesystem::path& path, const void* data, size_t size) {
+		std::error_code error;
+		std::filesystem::create_directories(path.parent_path(), error);
+
+		std::ofstream out(path, std::ios::out | std::ios::binary);
+		if (!out.is_open())
+			return false;
+
+		out.write((const char*)data, size);
+		return true;
+	}
+
+	bool ShaderCache::FindProgram(const std::string& name, uint64_t key, ProgramEntry& outEntry) {
+		std::scoped_lock lock(s_Data.Mutex);
+		LoadManifest();
+
+		auto it = s_Data.Programs.find(name);
+		if (it == s_Data.Programs.end() || it->second.Key != key)
+			return false;
+
+		if (!std::filesystem::exists(it->second.BinaryPath))
+			return false;
+
+		outEntry = it->second;
+		return true;
+	}
+
+	void ShaderCache::StoreProgram(const std::string& name, const ProgramEntry& entry) {
+		std::scoped_lock lock(s_Data.Mutex);
+		LoadManifest();
+
+		// The old binary can never be hit again
+		auto it = s_Data.Programs.find(name);
+		if (it != s_Data.Programs.end() && it->second.BinaryPath != entry.BinaryPath) {
+			std::error_code error;
+			std::filesystem::remove(it->second.BinaryPath, error);
+		}
+
+		s_Data.Programs[name] = entry;
+		SaveManifest();
+	}
+
+	void ShaderCache::RemoveProgram(const std::string& name) {
+		std::scoped_lock lock(s_Data.Mutex);
+		LoadManifest();
+
+		if (s_Data.Programs.erase(name))
+			SaveManifest();
+	}
+
+	void ShaderCache::LoadManifest() {
+		if (s_Data.ManifestLoaded)
+			return;
+
+		s_Data.ManifestLoaded = true;
+
+		std::filesystem::path path = Utils::GetManifestPath();
+		if (!std::filesystem::exists(path))
+			return;
+
+		YAML::Node data;
+		try
+		{
+			data = YAML::LoadFile(path.string());
+		}
+		catch (YAML::Exception e)
+		{
+			NB_ERROR("[ShaderCache] Failed to load manifest '{0}'\n     {1}", path.string(), e.what());
+			return;
+		}
+
+		auto programs = data["Programs"];
+		if (!programs)
+			return;
+
+		for (const auto& node : programs)
+		{
+			ProgramEntry entry;
+			entry.Key = std::stoull(node["Key"].as<std::string>(), nullptr, 16);
+			entry.BinaryFormat = node["Format"].as<uint32_t>();
+			entry.BinaryPath = s_Data.CacheDirectory / node["Binary"].as<std::string>();
+
+			s_Data.Programs[node["Name"].as<std::string>()] = entry;
+		}
+	}
+
+	void ShaderCache::SaveManifest() {
+		YAML::Emitter out;
+		out << YAML::BeginMap; // Root
+		out << YAML::Key << "Programs" << YAML::Value;
+		out << YAML::BeginSeq; // Programs
+
+		for (const auto& [name, entry] : s_Data.Programs)
+		{
+			out << YAML::BeginMap;
+			out << YAML::Key << "Name" << YAML::Value << name;
+			out << YAML::Key << "Key" << YAML::Value << KeyToString(entry.Key);
+			out << YAML::Key << "Format" << YAML::Value << entry.BinaryFormat;
+			out << YAML::Key << "Binary" << YAML::Value << entry.BinaryPath.filename().string();
+			out << YAML::EndMap;
+		}
+
+		out << YAML::EndSeq; // Programs
+		out << YAML::EndMap; // Root
+
+		std::error_code error;
+		std::filesystem::create_directories(s_Data.CacheDirectory, error);
+
+		std::ofstream fout(Utils::GetManifestPath());
+		fout << out.c_str();
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Nebula/Core/API.h"
+
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+namespace Nebula {
+	// Content addressed cache for compiled shaders. Cache files are named after a hash of everything
+	// that went into them, so an edited shader can never pick up a stale binary.
+	// Linked program binaries are tracked in a manifest. Nothing here touches the graphics API.
+	class ShaderCache {
+	public:
+		struct ProgramEntry {
+			uint64_t Key = 0;
+			uint32_t BinaryFormat = 0;
+			std::filesystem::path BinaryPath;
+		};
+
+		static uint64_t Hash(const void* data, size_t size, uint64_t seed = 14695981039346656037ull);
+		static uint64_t Hash(std::string_view data, uint64_t seed = 14695981039346656037ull) { return Hash(data.data(), data.size(), seed); }
+		static uint64_t Combine(uint64_t seed, uint64_t value);
+		static std::string KeyToString(uint64_t key);
+
+		static void SetCacheDirectory(const std::filesystem::path& directory);
+		static const std::filesystem::path& GetCacheDirectory();
+		static std::filesystem::path GetCachePath(uint64_t key, std::string_view extension);
+
+		// Returns false if the file is missing, a corrupt file is deleted so it gets compiled again
+		static bool ReadBinary(const std::filesystem::path& path, std::vector<uint32_t>& outData);
+		static bool WriteBinary(const std::filesystem::path& path, const void* data, size_t size);
+
+		// Returns false if there is no program with this name and key
+		static bool FindProgram(const std::string& name, uint64_t key, ProgramEntry& outEntry);
+		static void StoreProgram(const std::string& name, const ProgramEntry& entry);
+		static void RemoveProgram(const std::string& name);
+	private:
+		static void LoadManifest();
+		static void SaveManifest();
+
+		static void DiscardBinary(const std::filesystem::path& path);
+	};
+}
@@ -3,11 +3,12 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGl/OpenGL_Texture.h"
+#include "Platform/Null/Null_Texture.h"
 
 namespace Nebula {
 	Ref<Texture2D> Texture2D::Create(const TextureSpecification& specification, Buffer data) {
 		switch (RendererAPI::GetAPI()) {
-			case RendererAPI::API::None:	NB_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::None:	return CreateRef<Null_Texture2D>(specification);
 			case RendererAPI::API::OpenGL:	return CreateRef<OpenGL_Texture2D>(specification, data);
 		}
 
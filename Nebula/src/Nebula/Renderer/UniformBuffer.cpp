@@ -3,6 +3,7 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGL/OpenGL_UniformBuffer.h"
+#include "Platform/Null/Null_UniformBuffer.h"
 
 namespace Nebula {
 
@@ -10,7 +11,7 @@ namespace Nebula {
 	{
 		switch (Renderer::GetAPI())
 		{
-		case RendererAPI::API::None:    NB_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::None:    return CreateRef<Null_UniformBuffer>();
 		case RendererAPI::API::OpenGL:  return CreateRef<OpenGL_UniformBuffer>(size, binding);
 		}
 
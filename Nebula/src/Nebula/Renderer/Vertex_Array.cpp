@@ -2,12 +2,13 @@
 #include "Vertex_Array.h"
 
 #include "Platform/OpenGl/OpenGL_VertexArray.h"
+#include "Platform/Null/Null_VertexArray.h"
 #include "Renderer.h"
 
 namespace Nebula {
 	Ref<VertexArray> VertexArray::Create() {
 		switch (Renderer::GetAPI()) {
-			case RendererAPI::API::None:		NB_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::None:		return CreateRef<Null_VertexArray>();
 			case RendererAPI::API::OpenGL:		return CreateRef<OpenGL_VertexArray>();
 		}
 
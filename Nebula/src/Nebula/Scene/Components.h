@@ -2,12 +2,14 @@
 
 #include "Nebula/Maths/Maths.h"
 #include "Nebula/Maths/Transform.h"
+#include "Nebula/Maths/Affine2D.h"
 
 #include "Nebula/Renderer/Camera.h"
 #include "Nebula/Renderer/Fonts.h"
 #include "Scene_Camera.h"
 
 #include "Nebula/Core/UUID.h"
+#include "Nebula/Core/NameID.h"
 
 #include "Nebula/AssetManager/AssetManager.h"
 #include "Nebula/Project/Project.h"
@@ -16,47 +18,67 @@
 #include "Nebula/Renderer/Texture.h"
 #include "Nebula/Utils/Arrays.h"
 
+#include "entt.hpp"
 
 namespace Nebula {
 	struct IDComponent {
 		UUID ID;
+		// Bumped whenever a pooled instance is spawned again, script handles from an earlier spawn stop resolving
+		uint32_t Generation = 0;
 
 		IDComponent() = default;
 		IDComponent(const IDComponent&) = default;
 	};
 
 	struct TagComponent {
-		std::string Tag;
+		NameID Tag;
+
+		// Kept by the scene's tag index, rename through Entity::SetName so the index sees it
+		NameID IndexedTag;
+		uint32_t TagSlot = UINT32_MAX, ChildSlot = UINT32_MAX;
+		entt::entity IndexedParent = entt::null;
 
 		TagComponent() = default;
 		TagComponent(const TagComponent&) = default;
-		TagComponent(const std::string& tag) : Tag(tag) { }
+		TagComponent(NameID tag) : Tag(tag) { }
 	};
 
 	struct PropertiesComponent {
+		// Identity of one of the project's layers, ProjectConfig::Layers holds its name
+		uint16_t Layer = ProjectLayer::A;
 		bool Enabled = true;
-		Ref<ProjectLayer> Layer;
 		
 		PropertiesComponent() = default;
 		PropertiesComponent(const PropertiesComponent&) = default;
 	};
 
+	// Present while PropertiesComponent::Enabled is false, set both through Entity::SetEnabled.
+	// Systems skip disabled entities with entt::exclude<DisabledTag> instead of checking every entity
+	struct DisabledTag { };
+
+	// Runtime links only, UUIDs are resolved when (de)serializing.
+	// Use Scene::SetParent and Scene::MoveAfter to change them.
 	struct ParentChildComponent {
-		UUID Parent = NULL;
-		Array<UUID> ChildrenIDs;
+		entt::entity Parent = entt::null;
+		entt::entity FirstChild = entt::null;
+		entt::entity LastChild = entt::null;
+		entt::entity PrevSibling = entt::null;
+		entt::entity NextSibling = entt::null;
+		uint32_t ChildCount = 0;
 		
 		ParentChildComponent() = default;
 		ParentChildComponent(const ParentChildComponent&) = default;
+	};
 
-		UUID operator[](int index) { return ChildrenIDs[index]; }
-
-		void AddChild(UUID id) {
-			ChildrenIDs.push_back(id);
-		}
+	// Root of a prefab instance created through PrefabSerializer::Spawn, kept by the scene's prefab pool.
+	// Slot is the position in the pool's free list while the instance is despawned
+	struct PooledComponent {
+		uint32_t Pool = UINT32_MAX;
+		uint32_t Slot = UINT32_MAX;
 
-		void RemoveChild(UUID id) {
-			ChildrenIDs.remove(id);
-		}
+		PooledComponent() = default;
+		PooledComponent(const PooledComponent&) = default;
+		PooledComponent(uint32_t pool) : Pool(pool) { }
 	};
 
 	struct TransformComponent {
@@ -71,13 +93,29 @@ namespace Nebula {
 		inline glm::mat4 CalculateMatrix() const {
 			return glm::translate(Translation) * glm::toMat4(glm::quat(Rotation)) * glm::scale(Scale);
 		}
+
+		inline Affine2D CalculateAffine() const {
+			return Affine2D::FromTRS(Translation, Rotation, Scale);
+		}
 	};
 
 	struct WorldTransformComponent {
-		glm::mat4 Transform = glm::mat4(1.0f);
+		Affine2D Transform;
+		// Decomposed once whenever the transform is recalculated
+		float Rotation = 0.0f;
+		glm::vec2 Scale = { 1.0f, 1.0f };
+		bool Dirty = true;
 
 		WorldTransformComponent() = default;
 		WorldTransformComponent(const WorldTransformComponent&) = default;
+
+		glm::vec3 GetTranslation() const { return Transform.GetTranslation(); }
+
+		void SetTransform(const Affine2D& transform) {
+			Transform = transform;
+			Rotation = transform.GetRotation();
+			Scale = transform.GetScale();
+		}
 	};
 
 	struct CameraComponent {
@@ -91,7 +129,8 @@ namespace Nebula {
 
 	struct ScriptComponent
 	{
-		std::string ClassName;
+		// Namespace.Class, the key of ScriptEngine::GetEntityClasses()
+		NameID ClassName;
 
 		ScriptComponent() = default;
 		ScriptComponent(const ScriptComponent&) = default;
@@ -188,6 +227,8 @@ namespace Nebula {
 		bool Trigger = false;
 
 		void* RuntimeBody = nullptr;
+		// Set when the world transform is recalculated, the body catches up before the next step
+		bool RuntimeMoved = false;
 
 		Rigidbody2DComponent() = default;
 		Rigidbody2DComponent(const Rigidbody2DComponent&) = default;
@@ -251,4 +292,18 @@ namespace Nebula {
 		SpriteRendererComponent, CircleRendererComponent, StringRendererComponent,
 		Rigidbody2DComponent, BoxCollider2DComponent, CircleColliderComponent
 	>;
+
+	// Stamped by the scene's change tracker whenever they are added, replaced, patched or marked dirty
+	using TrackedComponents = ComponentGroup <
+		TagComponent, PropertiesComponent, TransformComponent,
+		CameraComponent, ScriptComponent,
+		SpriteRendererComponent, CircleRendererComponent, StringRendererComponent,
+		Rigidbody2DComponent, BoxCollider2DComponent, CircleColliderComponent
+	>;
+
+	template<typename T, typename... Component>
+	constexpr bool ContainsComponent(ComponentGroup<Component...>) { return (std::is_same_v<T, Component> || ...); }
+
+	template<typename T>
+	constexpr bool IsTrackedComponent = ContainsComponent<T>(TrackedComponents{});
 }
\ No newline at end of file
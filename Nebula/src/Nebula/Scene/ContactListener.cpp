@@ -54,8 +54,6 @@ namespace Nebula {
 
 	void ContactListener::Flush()
 	{
-		m_FlushingContacts = true;
-
 		for (uint32_t i = 0; i < m_Contacts.size(); i++)
 		{
 			Contact& contact = m_Contacts[i];
@@ -72,27 +70,7 @@ namespace Nebula {
 			}
 		}
 
-		m_FlushingContacts = false;
 		m_Contacts.clear();
-		
-		m_DeletingEntities = true;
-
-		for (const UUID& uuid : m_EntitiesToDelete)
-		{
-			Entity entity = { uuid, m_Scene };
-			m_Scene->DestroyEntity(entity);
-		}
-
-		m_DeletingEntities = true;
-		m_EntitiesToDelete.clear();
-	}
-
-	void ContactListener::DeleteEntity(UUID entity)
-	{
-		if (m_EntitiesToDelete.find(entity) != m_EntitiesToDelete.size())
-			return;
-
-		m_EntitiesToDelete.push_back(entity);
 	}
 
 	void ContactListener::CallEntityEnter(UUID a, UUID b)
@@ -23,16 +23,15 @@ namespace Nebula
 		void EndContact(b2Contact* contact) override;
 
 		void Flush();
-		void DeleteEntity(UUID entity);
 
-		inline bool IsFlushing() const { return m_FlushingContacts; }
+		// While bodies are being destroyed, exit callbacks run immediately instead of waiting for Flush()
+		void SetDeletingEntities(bool deleting) { m_DeletingEntities = deleting; }
 	private:
 		void CallEntityEnter(UUID entity, UUID other);
 		void CallEntityExit(UUID entity, UUID other);
 
 		Scene* m_Scene;
 		Array<Contact> m_Contacts;
-		Array<UUID> m_EntitiesToDelete;
-		bool m_FlushingContacts = false, m_DeletingEntities = false;
+		bool m_DeletingEntities = false;
 	};
 }
\ No newline at end of file
@@ -7,30 +7,26 @@
 #include "box2d/b2_circle_shape.h"
 
 namespace Nebula {
-	void Entity::CalculateTransform() {
-		auto& world = GetComponent<WorldTransformComponent>();
-		glm::mat4 transform = GetTransform().CalculateMatrix();
-		world.Transform = transform;
-		
-		UUID parentID = GetParentChild().Parent;
-		if (parentID) {
-			Entity parent = { parentID, m_Scene };
-			parent.CalculateTransform();
-			auto& pWorld = parent.GetComponent<WorldTransformComponent>();
-			world.Transform = pWorld.Transform * transform;
-		}
+	void Entity::MarkTransformDirty() {
+		GetComponent<WorldTransformComponent>().Dirty = true;
+		m_Scene->m_PickerOutdated = true;
+		MarkDirty<TransformComponent>();
 	}
 
-	void Entity::UpdateTransform() {
-		CalculateTransform();
+	void Entity::SetEnabled(bool enabled) {
+		GetComponent<PropertiesComponent>().Enabled = enabled;
+		MarkDirty<PropertiesComponent>();
+		m_Scene->m_PickerOutdated = true;
 
-		for (UUID id : GetParentChild().ChildrenIDs)
-		{
-			Entity child = { id, m_Scene };
-			child.UpdateTransform();
-		}
+		if (enabled)
+			m_Scene->m_Registry.remove_if_exists<DisabledTag>(m_EntityHandle);
+		else if (!HasComponent<DisabledTag>())
+			m_Scene->m_Registry.emplace<DisabledTag>(m_EntityHandle);
+	}
 
-		UpdatePhysicsBody();
+	WorldTransformComponent& Entity::GetWorldTransform() {
+		m_Scene->ResolveTransform(m_EntityHandle);
+		return GetComponent<WorldTransformComponent>();
 	}
 
 	void Entity::UpdatePhysicsBody()
@@ -38,17 +34,19 @@ namespace Nebula {
 		if (!HasComponent<Rigidbody2DComponent>())
 			return;
 
-		WorldTransformComponent& transform = GetComponent<WorldTransformComponent>();
+		// Read straight from the registry, following the transform is not a change to the physics components
+		entt::registry& registry = m_Scene->m_Registry;
+		WorldTransformComponent& transform = registry.get<WorldTransformComponent>(m_EntityHandle);
 
-		glm::vec3 translation, rotation, scale;
-		Maths::DecomposeTransform(transform.Transform, translation, rotation, scale);
+		glm::vec3 translation = transform.GetTranslation();
+		glm::vec2 scale = transform.Scale;
 		
-		if (b2Body* body = (b2Body*)GetComponent<Rigidbody2DComponent>().RuntimeBody)
-			body->SetTransform({ translation.x, translation.y }, rotation.z);
+		if (b2Body* body = (b2Body*)registry.get<Rigidbody2DComponent>(m_EntityHandle).RuntimeBody)
+			body->SetTransform({ translation.x, translation.y }, transform.Rotation);
 		
 		if (HasComponent<BoxCollider2DComponent>())
 		{
-			BoxCollider2DComponent bc2d = GetComponent<BoxCollider2DComponent>();
+			const auto& bc2d = registry.get<BoxCollider2DComponent>(m_EntityHandle);
 			if (b2Fixture* fixture = (b2Fixture*)bc2d.RuntimeFixture)
 			{
 				b2PolygonShape* shape = (b2PolygonShape*)fixture->GetShape();
@@ -59,7 +57,7 @@ namespace Nebula {
 
 		if (HasComponent<CircleColliderComponent>())
 		{
-			CircleColliderComponent cc = GetComponent<CircleColliderComponent>();
+			const auto& cc = registry.get<CircleColliderComponent>(m_EntityHandle);
 			if (b2Fixture* fixture = (b2Fixture*)cc.RuntimeFixture)
 			{
 				b2CircleShape* circle = (b2CircleShape*)fixture->GetShape();
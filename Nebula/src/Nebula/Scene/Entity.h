@@ -47,6 +47,19 @@ namespace Nebula {
 			return m_Scene->m_Registry.get<T>(m_EntityHandle);
 		}
 
+		// Records a change made through GetComponent, see Scene::EachChanged. Main thread only
+		template<typename T>
+		void MarkDirty() {
+			static_assert(IsTrackedComponent<T>, "Changes to this component are not tracked");
+			m_Scene->m_ChangeTracker.MarkChanged<T>(m_Scene->m_Registry, m_EntityHandle);
+		}
+
+		// The scene change version when T last changed on this entity
+		template<typename T>
+		uint64_t GetVersion() {
+			return m_Scene->m_ChangeTracker.GetEntityVersion<T>(m_Scene->m_Registry, m_EntityHandle);
+		}
+
 		template<typename T>
 		bool HasComponent() {
 			return m_Scene->m_Registry.has<T>(m_EntityHandle);
@@ -58,16 +71,29 @@ namespace Nebula {
 			m_Scene->m_Registry.remove<T>(m_EntityHandle);
 		}
 		
-		const std::string& GetName() { return GetComponent<TagComponent>().Tag; }
+		const std::string& GetName() { return m_Scene->m_Registry.get<TagComponent>(m_EntityHandle).Tag.GetString(); }
+		// Goes through the registry so the scene's tag index is updated
+		void SetName(NameID name) {
+			m_Scene->m_Registry.patch<TagComponent>(m_EntityHandle, [&](TagComponent& tc) { tc.Tag = name; });
+		}
 		UUID GetUUID() { return GetComponent<IDComponent>().ID; }
-		Ref<ProjectLayer> GetLayer() { return GetComponent<PropertiesComponent>().Layer; }
-		bool IsEnabled() { return GetComponent<PropertiesComponent>().Enabled; }
+		uint16_t GetLayer() { return m_Scene->m_Registry.get<PropertiesComponent>(m_EntityHandle).Layer; }
+		bool IsEnabled() { return m_Scene->m_Registry.get<PropertiesComponent>(m_EntityHandle).Enabled; }
+		void SetEnabled(bool enabled);
 
 		TransformComponent& GetTransform() { return GetComponent<TransformComponent>(); }
 		ParentChildComponent& GetParentChild() { return GetComponent<ParentChildComponent>(); }
 
-		void CalculateTransform();
-		void UpdateTransform();
+		// for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
+		Entity GetParent() { return { GetParentChild().Parent, m_Scene }; }
+		Entity GetFirstChild() { return { GetParentChild().FirstChild, m_Scene }; }
+		Entity GetNextSibling() { return { GetParentChild().NextSibling, m_Scene }; }
+		uint32_t GetChildCount() { return GetParentChild().ChildCount; }
+
+		// The world transform is recalculated by Scene::UpdateTransforms()
+		void MarkTransformDirty();
+		// Brings the world transform up to date first, if it or a parent is dirty
+		WorldTransformComponent& GetWorldTransform();
 		void UpdatePhysicsBody();
 
 		bool IsValid() const { return m_Scene->m_Registry.valid(m_EntityHandle); }
@@ -6,20 +6,43 @@
 
 #include "Nebula/Utils/YAML.h"
 
+#include "box2d/b2_body.h"
+
 namespace Nebula
 {
 #define WRITE_SCRIPT_FIELD(FieldType, Type)			\
 	case ScriptFieldType::FieldType: \
-		out << scriptInstance->GetFieldValue<Type>(name); \
+		out << scriptInstance->GetFieldValue<Type>(field.Name); \
 		break
 
 #define READ_SCRIPT_FIELD(FieldType, Type)			\
 	case ScriptFieldType::FieldType: {				\
 		Type data = scriptField["Data"].as<Type>(); \
-		scriptInstance->SetFieldValue(name, data); \
+		static_assert(sizeof(Type) <= sizeof(value.Data), "Type too large"); \
+		memcpy(value.Data, &data, sizeof(Type)); \
 		break; \
 	}
 
+	// A prefab parsed once into a scene of its own, which never runs.
+	// Script instances need a live entity, so their field values are kept as raw data until instantiation
+	struct PrefabTemplate
+	{
+		struct ScriptFieldValue
+		{
+			NameID Name;
+			ScriptFieldType Type = ScriptFieldType::None;
+			uint8_t Data[16] = {};
+		};
+
+		Ref<Scene> Entities = CreateRef<Scene>();
+		Entity Root;
+		std::unordered_map<UUID, Array<ScriptFieldValue>> ScriptFields;
+
+		std::filesystem::file_time_type LastWriteTime;
+	};
+
+	static std::unordered_map<std::string, Ref<PrefabTemplate>> s_Templates;
+
 	PrefabSerializer::PrefabSerializer(Scene* scene) : m_Scene(scene) { }
 
 	static void SerializeEntity(YAML::Emitter& out, Entity entity)
@@ -32,7 +55,7 @@ namespace Nebula
 			out << YAML::Key << "TagComponent";
 			out << YAML::BeginMap;
 
-			auto& tag = entity.GetComponent<TagComponent>().Tag;
+			const std::string& tag = entity.GetName();
 			out << YAML::Key << "Tag" << YAML::Value << tag;
 
 			out << YAML::EndMap;
@@ -44,7 +67,7 @@ namespace Nebula
 
 			auto& component = entity.GetComponent<PropertiesComponent>();
 			out << YAML::Key << "IsEnabled" << YAML::Value << component.Enabled;
-			out << YAML::Key << "Layer" << YAML::Value << component.Layer->Identity;
+			out << YAML::Key << "Layer" << YAML::Value << component.Layer;
 
 			out << YAML::EndMap; // TransformComponent
 		}
@@ -54,15 +77,16 @@ namespace Nebula
 			out << YAML::BeginMap; // ParentChildComponent
 
 			auto& component = entity.GetComponent<ParentChildComponent>();
+			Entity parent = entity.GetParent();
 
 			YAML::Node children;
-			for (uint32_t i = 0; i < component.ChildrenIDs.size(); i++)
-				children.push_back((uint64_t)component[i]);
+			for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
+				children.push_back((uint64_t)child.GetUUID());
 			children.SetStyle(YAML::EmitterStyle::Flow);
 
-			out << YAML::Key << "PrimaryParent" << YAML::Value << component.Parent;
+			out << YAML::Key << "PrimaryParent" << YAML::Value << (parent ? (uint64_t)parent.GetUUID() : 0);
 			out << YAML::Key << "Children" << YAML::Value << children;
-			out << YAML::Key << "ChildCount" << YAML::Value << component.ChildrenIDs.size();
+			out << YAML::Key << "ChildCount" << YAML::Value << component.ChildCount;
 
 			out << YAML::EndMap; // ParentChildComponent
 		}
@@ -152,7 +176,7 @@ namespace Nebula
 						case ScriptFieldType::Font:
 						case ScriptFieldType::Texture:
 						case ScriptFieldType::Asset:
-							auto data = scriptInstance->GetFieldValue<MonoObject*>(name);
+							auto data = scriptInstance->GetFieldValue<MonoObject*>(field.Name);
 							out << ScriptEngine::GetIDFromObject(data);
 							break;
 						}
@@ -265,9 +289,8 @@ namespace Nebula
 		out << entity.GetUUID();
 		entities.push_back(entity.GetUUID());
 		
-		const auto& children = entity.GetParentChild().ChildrenIDs;
-		for (const auto& child : children)
-			SerializeOrder(out, { child, entity }, entities);
+		for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
+			SerializeOrder(out, child, entities);
 	}
 
 	void PrefabSerializer::Serialize(Entity entity, const std::string& filepath)
@@ -293,18 +316,58 @@ namespace Nebula
 		fout << out.c_str();
 	}
 
-	static UUID DeserializeID(std::unordered_map<UUID, UUID>& idMap, const YAML::Node& node)
+	Ref<PrefabTemplate> PrefabSerializer::GetTemplate(const std::string& filepath)
 	{
-		UUID id = DeserializeValue<uint64_t>(node);
+		std::error_code error;
+		auto lastWriteTime = std::filesystem::last_write_time(filepath, error);
+
+		auto it = s_Templates.find(filepath);
+		if (it != s_Templates.end() && !error && it->second->LastWriteTime == lastWriteTime)
+			return it->second;
+
+		NB_PROFILE_FUNCTION();
+
+		Ref<PrefabTemplate> prefab = CreateRef<PrefabTemplate>();
+		prefab->LastWriteTime = lastWriteTime;
 
-		auto it = idMap.find(id);
-		if (it == idMap.end())
-			return id;
+		PrefabSerializer parser(prefab->Entities.get());
+		if (!parser.Parse(filepath, *prefab))
+		{
+			s_Templates.erase(filepath);
+			return nullptr;
+		}
+
+		s_Templates[filepath] = prefab;
+		return prefab;
+	}
+
+	Entity PrefabSerializer::Deserialize(const std::string& filepath)
+	{
+		Ref<PrefabTemplate> prefab = GetTemplate(filepath);
+		if (!prefab)
+			return {};
 
-		return it->second;
+		return Instantiate(*prefab);
 	}
 
-	Entity PrefabSerializer::Deserialize(const std::string & filepath)
+	Array<Entity> PrefabSerializer::Deserialize(const std::string& filepath, uint32_t count)
+	{
+		NB_PROFILE_FUNCTION();
+
+		Array<Entity> instances;
+
+		Ref<PrefabTemplate> prefab = GetTemplate(filepath);
+		if (!prefab)
+			return instances;
+
+		instances.reserve(count);
+		for (uint32_t i = 0; i < count; i++)
+			instances.push_back(Instantiate(*prefab));
+
+		return instances;
+	}
+
+	bool PrefabSerializer::Parse(const std::string& filepath, PrefabTemplate& prefab)
 	{
 		YAML::Node data;
 		try {
@@ -312,22 +375,15 @@ namespace Nebula
 		}
 		catch (YAML::Exception e) {
 			NB_ERROR("[Prefab Serializer] Failed to load file '{0}'\n     {1}", filepath, e.what());
-			return {};
-		}
-		
-		std::unordered_map<UUID, UUID> idMap;
-
-		for (auto& node : data["Order"])
-		{
-			UUID id = node.as<uint64_t>();
-			idMap[id] = UUID();
+			return false;
 		}
 
-		Entity returnEntity = {};
+		// The template keeps the ids from the file, instances get new ones
+		Array<std::pair<Entity, YAML::Node>> hierarchy;
 
 		for (auto& entity : data["Prefab"])
 		{
-			uint64_t uuid = DeserializeID(idMap, entity["Entity"]);
+			uint64_t uuid = DeserializeValue<uint64_t>(entity["Entity"]);
 
 			std::string name;
 			if (auto tagComponent = entity["TagComponent"])
@@ -336,28 +392,20 @@ namespace Nebula
 			NB_TRACE("Deserialized Prefab with name = {0}", name);
 			Entity deserializedEntity = m_Scene->CreateEntity(uuid, name);
 
-			if (!returnEntity)
-				returnEntity = deserializedEntity;
-#
+			if (!prefab.Root)
+				prefab.Root = deserializedEntity;
+
 			if (auto propComponent = entity["PropertiesComponent"]) {
 				auto& prop = deserializedEntity.GetComponent<PropertiesComponent>();
-				DeserializeValue(prop.Enabled, propComponent["IsEnabled"]);
+				deserializedEntity.SetEnabled(DeserializeValue(propComponent["IsEnabled"], true));
 
 				uint16_t layer = DeserializeValue(propComponent["Layer"], 1);
-				prop.Layer = Project::GetActive()->GetConfig().Layers[layer];
+				prop.Layer = layer;
 			}
 
 			if (auto parentComponent = entity["ParentChildComponent"]) {
-				auto& pcc = deserializedEntity.GetComponent<ParentChildComponent>();
-
-				pcc.Parent = DeserializeID(idMap, parentComponent["PrimaryParent"]);
-				if (pcc.Parent)
-					m_Scene->m_SceneOrder.remove(uuid);
-
-				uint32_t count = DeserializeValue<uint32_t>(parentComponent["ChildCount"]);
-				auto children = parentComponent["Children"];
-				for (uint32_t i = 0; i < count; i++)
-					pcc.AddChild(DeserializeID(idMap, children[i]));
+				if (auto children = parentComponent["Children"])
+					hierarchy.push_back({ deserializedEntity, children });
 			}
 
 			if (auto transformComponent = entity["TransformComponent"]) {
@@ -392,58 +440,42 @@ namespace Nebula
 				auto& sc = deserializedEntity.AddComponent<ScriptComponent>();
 				DeserializeValue(sc.ClassName, scriptComponent["Class"]);
 
-				Ref<ScriptInstance> scriptInstance = ScriptEngine::CreateScriptInstance(deserializedEntity);
 				if (auto scriptFields = scriptComponent["ScriptFields"])
 				{
-					if (Ref<ScriptClass> entityClass = ScriptEngine::GetEntityClass(sc.ClassName))
+					auto& values = prefab.ScriptFields[uuid];
+					for (auto scriptField : scriptFields)
 					{
-						const auto& fields = entityClass->GetFields();
-						for (auto scriptField : scriptFields)
+						PrefabTemplate::ScriptFieldValue value;
+						value.Name = scriptField["Name"].as<NameID>();
+						value.Type = Utils::ScriptFieldTypeFromString(scriptField["Type"].as<std::string>());
+
+						switch (value.Type)
 						{
-							std::string name = scriptField["Name"].as<std::string>();
-							std::string typeString = scriptField["Type"].as<std::string>();
-							ScriptFieldType type = Utils::ScriptFieldTypeFromString(typeString);
-
-							auto it = fields.find(name);
-							if (it == fields.end())
-								continue;
-
-							switch (type)
-							{
-								READ_SCRIPT_FIELD(Float, float);
-								READ_SCRIPT_FIELD(Double, double);
-								READ_SCRIPT_FIELD(Bool, bool);
-								READ_SCRIPT_FIELD(Char, char);
-								READ_SCRIPT_FIELD(Byte, int8_t);
-								READ_SCRIPT_FIELD(Short, int16_t);
-								READ_SCRIPT_FIELD(Int, int32_t);
-								READ_SCRIPT_FIELD(Long, int64_t);
-								READ_SCRIPT_FIELD(SByte, uint8_t);
-								READ_SCRIPT_FIELD(UShort, uint16_t);
-								READ_SCRIPT_FIELD(UInt, uint32_t);
-								READ_SCRIPT_FIELD(ULong, uint64_t);
-								READ_SCRIPT_FIELD(Vector2, glm::vec2);
-								READ_SCRIPT_FIELD(Vector3, glm::vec3);
-								READ_SCRIPT_FIELD(Vector4, glm::vec4);
-							case ScriptFieldType::Entity:
-							{
-								UUID data = DeserializeID(idMap, scriptField["Data"]);
-								MonoObject* object = ScriptEngine::CreateEntityClass(data);
-								scriptInstance->SetFieldValueInternal(name, object);
-								break;
-							}
-							case ScriptFieldType::Prefab:
-							case ScriptFieldType::Font:
-							case ScriptFieldType::Texture:
-							case ScriptFieldType::Asset:
-							{
-								AssetHandle data = scriptField["Data"].as<uint64_t>();
-								MonoObject* object = ScriptEngine::CreateAssetClass(data);
-								scriptInstance->SetFieldValueInternal(name, object);
-								break;
-							}
-							}
+							READ_SCRIPT_FIELD(Float, float);
+							READ_SCRIPT_FIELD(Double, double);
+							READ_SCRIPT_FIELD(Bool, bool);
+							READ_SCRIPT_FIELD(Char, char);
+							READ_SCRIPT_FIELD(Byte, int8_t);
+							READ_SCRIPT_FIELD(Short, int16_t);
+							READ_SCRIPT_FIELD(Int, int32_t);
+							READ_SCRIPT_FIELD(Long, int64_t);
+							READ_SCRIPT_FIELD(SByte, uint8_t);
+							READ_SCRIPT_FIELD(UShort, uint16_t);
+							READ_SCRIPT_FIELD(UInt, uint32_t);
+							READ_SCRIPT_FIELD(ULong, uint64_t);
+							READ_SCRIPT_FIELD(Vector2, glm::vec2);
+							READ_SCRIPT_FIELD(Vector3, glm::vec3);
+							READ_SCRIPT_FIELD(Vector4, glm::vec4);
+							READ_SCRIPT_FIELD(Entity, uint64_t);
+							READ_SCRIPT_FIELD(Prefab, uint64_t);
+							READ_SCRIPT_FIELD(Font, uint64_t);
+							READ_SCRIPT_FIELD(Texture, uint64_t);
+							READ_SCRIPT_FIELD(Asset, uint64_t);
+						default:
+							continue;
 						}
+
+						values.push_back(value);
 					}
 				}
 			}
@@ -512,13 +544,297 @@ namespace Nebula
 				DeserializeValue(cc.RestitutionThreshold, circleColliderComponent["RestitutionThreshold"]);
 				DeserializeValue(cc.Mask, circleColliderComponent["Mask"]);
 			}
+		}
+
+		// The prefab root keeps no parent, it is instantiated as a root entity
+		for (auto& [parent, children] : hierarchy)
+		{
+			for (auto child : children)
+			{
+				if (Entity childEntity = { UUID(child.as<uint64_t>()), m_Scene })
+					m_Scene->SetParent(childEntity, parent);
+			}
+		}
+
+		return (bool)prefab.Root;
+	}
+
+	static Entity InstantiateEntity(Scene* scene, Entity source, std::unordered_map<UUID, UUID>& idMap, Array<std::pair<Entity, Entity>>& created)
+	{
+		Entity entity = scene->CopyEntity(source);
+		idMap[source.GetUUID()] = entity.GetUUID();
+		created.push_back({ source, entity });
+
+		for (Entity child = source.GetFirstChild(); child; child = child.GetNextSibling())
+			scene->SetParent(InstantiateEntity(scene, child, idMap, created), entity);
+
+		return entity;
+	}
 
-			deserializedEntity.CalculateTransform();
+	static void ApplyScriptFields(Ref<ScriptInstance> scriptInstance, const PrefabTemplate& prefab, Entity source, const std::unordered_map<UUID, UUID>& idMap)
+	{
+		if (!scriptInstance)
+			return;
+
+		auto it = prefab.ScriptFields.find(source.GetUUID());
+		if (it == prefab.ScriptFields.end())
+			return;
 
-			if (deserializedEntity.HasComponent<Rigidbody2DComponent>())
-				m_Scene->UpdateBox2DBody(deserializedEntity);
+		for (const auto& value : it->second)
+		{
+			switch (value.Type)
+			{
+			case ScriptFieldType::Entity:
+			{
+				// References inside the prefab point at this instance
+				UUID data = *(const uint64_t*)value.Data;
+				auto mapped = idMap.find(data);
+				if (mapped != idMap.end())
+					data = mapped->second;
+
+				MonoObject* object = ScriptEngine::CreateEntityClass(data);
+				scriptInstance->SetFieldValueInternal(value.Name, object);
+				break;
+			}
+			case ScriptFieldType::Prefab:
+			case ScriptFieldType::Font:
+			case ScriptFieldType::Texture:
+			case ScriptFieldType::Asset:
+			{
+				AssetHandle data = *(const uint64_t*)value.Data;
+				MonoObject* object = ScriptEngine::CreateAssetClass(data);
+				scriptInstance->SetFieldValueInternal(value.Name, object);
+				break;
+			}
+			default:
+				scriptInstance->SetFieldValueInternal(value.Name, value.Data);
+				break;
+			}
 		}
+	}
 
-		return returnEntity;
+	Entity PrefabSerializer::Instantiate(const PrefabTemplate& prefab)
+	{
+		std::unordered_map<UUID, UUID> idMap;
+		Array<std::pair<Entity, Entity>> created;
+
+		Entity root = InstantiateEntity(m_Scene, prefab.Root, idMap, created);
+
+		for (auto& [source, entity] : created)
+		{
+			// Bodies were created with the components, before the hierarchy moved them
+			if (entity.HasComponent<Rigidbody2DComponent>())
+				m_Scene->UpdateBox2DBody(entity);
+
+			if (entity.HasComponent<ScriptComponent>())
+				ApplyScriptFields(ScriptEngine::CreateScriptInstance(entity), prefab, source, idMap);
+		}
+
+		return root;
+	}
+
+	/* ------- */
+
+	// Same order as InstantiateEntity, so the nth entity of an instance was copied from the nth entity of the template
+	static void CollectSubtree(Entity root, Array<Entity>& entities)
+	{
+		entities.push_back(root);
+		for (Entity child = root.GetFirstChild(); child; child = child.GetNextSibling())
+			CollectSubtree(child, entities);
+	}
+
+	template<typename T>
+	static void ResetComponent(T& component, const T& source) { component = source; }
+
+	// Keep the physics objects, they are updated from the reset values
+	static void ResetComponent(Rigidbody2DComponent& component, const Rigidbody2DComponent& source)
+	{
+		void* body = component.RuntimeBody;
+		component = source;
+		component.RuntimeBody = body;
+	}
+
+	static void ResetComponent(BoxCollider2DComponent& component, const BoxCollider2DComponent& source)
+	{
+		void* fixture = component.RuntimeFixture;
+		component = source;
+		component.RuntimeFixture = fixture;
+	}
+
+	static void ResetComponent(CircleColliderComponent& component, const CircleColliderComponent& source)
+	{
+		void* fixture = component.RuntimeFixture;
+		component = source;
+		component.RuntimeFixture = fixture;
+	}
+
+	// Native scripts are bound in code, not by the prefab
+	static void ResetComponent(NativeScriptComponent& component, const NativeScriptComponent& source) { }
+
+	template<typename... Component>
+	static void ResetComponents(ComponentGroup<Component...>, Entity entity, Entity source)
+	{
+		([&]()
+		{
+			if (source.HasComponent<Component>())
+				ResetComponent(entity.GetComponent<Component>(), source.GetComponent<Component>());
+		}(), ...);
+	}
+
+	template<typename... Component>
+	static bool HasSameComponents(ComponentGroup<Component...>, Entity entity, Entity source)
+	{
+		return ((entity.HasComponent<Component>() == source.HasComponent<Component>()) && ...);
+	}
+
+	// Scripts may have added or removed children and components since the instance was spawned
+	static bool MatchesTemplate(const Array<Entity>& instance, const Array<Entity>& source)
+	{
+		if (instance.size() != source.size())
+			return false;
+
+		for (size_t i = 0; i < instance.size(); i++)
+		{
+			if (!HasSameComponents(AllComponents{}, instance[i], source[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool PrefabSerializer::Reset(const PrefabTemplate& prefab, Entity root)
+	{
+		Array<Entity> instance, source;
+		CollectSubtree(root, instance);
+		CollectSubtree(prefab.Root, source);
+
+		// The template is parsed again when the file changes, which may have happened while the instance was pooled
+		if (!MatchesTemplate(instance, source))
+			return false;
+
+		std::unordered_map<UUID, UUID> idMap;
+		for (size_t i = 0; i < instance.size(); i++)
+			idMap[source[i].GetUUID()] = instance[i].GetUUID();
+
+		for (size_t i = 0; i < instance.size(); i++)
+		{
+			Entity entity = instance[i];
+			ResetComponents(AllComponents{}, entity, source[i]);
+			entity.GetComponent<IDComponent>().Generation++;
+			entity.SetEnabled(source[i].IsEnabled());
+			entity.MarkTransformDirty();
+		}
+
+		for (size_t i = 0; i < instance.size(); i++)
+		{
+			Entity entity = instance[i];
+
+			if (entity.HasComponent<Rigidbody2DComponent>())
+			{
+				if (b2Body* body = (b2Body*)entity.GetComponent<Rigidbody2DComponent>().RuntimeBody)
+				{
+					m_Scene->UpdateBox2DBody(entity);
+					body->SetLinearVelocity({ 0.0f, 0.0f });
+					body->SetAngularVelocity(0.0f);
+				}
+			}
+
+			if (entity.HasComponent<ScriptComponent>())
+			{
+				Ref<ScriptInstance> scriptInstance = ScriptEngine::GetScriptInstance(entity);
+				ApplyScriptFields(scriptInstance, prefab, source[i], idMap);
+
+				if (scriptInstance)
+					scriptInstance->ResetOnCreate();
+			}
+		}
+
+		return true;
+	}
+
+	Entity PrefabSerializer::Spawn(const std::string& filepath)
+	{
+		Ref<PrefabTemplate> prefab = GetTemplate(filepath);
+		if (!prefab)
+			return {};
+
+		ScenePrefabPool& pool = m_Scene->m_PrefabPool;
+		uint32_t index = pool.GetPool(filepath);
+
+		entt::entity handle = pool.Acquire(m_Scene->m_Registry, index);
+		if (handle != entt::null)
+		{
+			Entity root = { handle, m_Scene };
+			if (Reset(*prefab, root))
+				return root;
+
+			// Pooled before the prefab was edited, a fresh instance replaces it
+			m_Scene->DestroyEntity(root);
+		}
+
+		Entity root = Instantiate(*prefab);
+		pool.Track(m_Scene->m_Registry, root, index);
+		return root;
+	}
+
+	void PrefabSerializer::Despawn(Entity root)
+	{
+		if (!root.HasComponent<PooledComponent>())
+		{
+			m_Scene->DestroyEntity(root);
+			return;
+		}
+
+		const auto& pc = root.GetComponent<PooledComponent>();
+		if (pc.Slot != UINT32_MAX)
+			return;
+
+		Ref<PrefabTemplate> prefab = GetTemplate(m_Scene->m_PrefabPool.GetFilepath(pc.Pool));
+
+		Array<Entity> instance, source;
+		CollectSubtree(root, instance);
+		if (prefab)
+			CollectSubtree(prefab->Root, source);
+
+		if (!MatchesTemplate(instance, source))
+		{
+			m_Scene->DestroyEntity(root);
+			return;
+		}
+
+		m_Scene->SetParent(root, {});
+
+		for (Entity entity : instance)
+		{
+			entity.SetEnabled(false);
+
+			if (entity.HasComponent<Rigidbody2DComponent>())
+			{
+				if (b2Body* body = (b2Body*)entity.GetComponent<Rigidbody2DComponent>().RuntimeBody)
+					body->SetEnabled(false);
+			}
+		}
+
+		m_Scene->m_PrefabPool.Release(m_Scene->m_Registry, root);
+	}
+
+	void PrefabSerializer::Prewarm(const std::string& filepath, uint32_t count)
+	{
+		NB_PROFILE_FUNCTION();
+
+		Ref<PrefabTemplate> prefab = GetTemplate(filepath);
+		if (!prefab)
+			return;
+
+		ScenePrefabPool& pool = m_Scene->m_PrefabPool;
+		uint32_t index = pool.GetPool(filepath);
+
+		// Counted up front, an instance that fails to despawn must not loop forever
+		for (uint32_t i = pool.GetStats(filepath).Free; i < count; i++)
+		{
+			Entity root = Instantiate(*prefab);
+			pool.Track(m_Scene->m_Registry, root, index);
+			Despawn(root);
+		}
 	}
 }
\ No newline at end of file
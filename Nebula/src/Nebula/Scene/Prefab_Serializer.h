@@ -4,14 +4,36 @@
 
 namespace Nebula
 {
+	struct PrefabTemplate;
+
 	class PrefabSerializer
 	{
 	public:
 		PrefabSerializer(Scene* scene);
 
 		void Serialize(Entity entity, const std::string& filepath);
+
+		// The file is only parsed again when it has changed, every instance is copied from the cached template
 		Entity Deserialize(const std::string& filepath);
+		// Creates count instances from a single template lookup, returns the root of each
+		Array<Entity> Deserialize(const std::string& filepath, uint32_t count);
+
+		// Reuses a despawned instance when the scene's pool has one, resetting it to the prefab's values.
+		// Pooled entities keep their UUID and script instance, OnCreate runs again before their next update
+		Entity Spawn(const std::string& filepath);
+		// Disables a spawned instance and keeps it for the next Spawn.
+		// Anything else, or an instance whose children or components have changed, is destroyed instead
+		void Despawn(Entity root);
+		// Fills the pool up to count despawned instances
+		void Prewarm(const std::string& filepath, uint32_t count);
+	private:
+		static Ref<PrefabTemplate> GetTemplate(const std::string& filepath);
+
+		bool Parse(const std::string& filepath, PrefabTemplate& prefab);
+		Entity Instantiate(const PrefabTemplate& prefab);
+		// Fails without touching the instance if it no longer has the template's layout
+		bool Reset(const PrefabTemplate& prefab, Entity root);
 	private:
 		Scene* m_Scene;
 	};
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 
 #include "Nebula/Renderer/Renderer2D.h"
 #include "Nebula/Scripting/ScriptEngine.h"
+#include "Nebula/Core/JobSystem.h"
 #include "Nebula/Utils/Time.h"
 #include "Nebula/Utils/Physics2D.h"
 #include "Nebula/Project/Project.h"
@@ -18,24 +19,24 @@
 #include "box2d/b2_circle_shape.h"
 
 namespace Nebula {
+	// Copies whole storages, the destination must already hold the same entity identifiers
 	template<typename... Component>
-	static void CopyComponent(entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& map) {
+	static void CloneStorage(entt::registry& dst, const entt::registry& src) {
 		([&]()
 			{
-				auto view = src.view<Component>();
-				for (auto srcEntity : view)
-				{
-					entt::entity dstEntity = map.at(src.get<IDComponent>(srcEntity).ID);
+				const entt::entity* entities = src.data<Component>();
+				size_t size = src.size<Component>();
 
-					auto& srcComponent = src.get<Component>(srcEntity);
-					dst.emplace_or_replace<Component>(dstEntity, srcComponent);
-				}
+				if constexpr (std::is_empty_v<Component>)
+					dst.insert<Component>(entities, entities + size);
+				else
+					dst.insert<Component>(entities, entities + size, src.raw<Component>(), src.raw<Component>() + size);
 			}(), ...);
 	}
 
 	template<typename... Component>
-	static void CopyComponent(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, const std::unordered_map<UUID, entt::entity>& enttMap) {
-		CopyComponent<Component...>(dst, src, enttMap);
+	static void CloneStorage(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src) {
+		CloneStorage<Component...>(dst, src);
 	}
 
 	template<typename... Component>
@@ -53,99 +54,209 @@ namespace Nebula {
 		CopyComponent<Component...>(dst, src);
 	}
 
-	Scene::Scene() { }
+	// The change tracker's per entity stamps, one storage per tracked component
+	template<typename... Component>
+	static ComponentGroup<ComponentVersion<Component>...> VersionsOf(ComponentGroup<Component...>) {
+		return {};
+	}
+
+	static uint32_t s_SceneEpoch = 0;
+
+	template<typename... Component>
+	void Scene::ConnectChangeSignals(ComponentGroup<Component...>) {
+		(m_ChangeTracker.Register<Component>(), ...);
+		(m_Registry.on_construct<Component>().template connect<&Scene::OnComponentChanged<Component>>(*this), ...);
+		(m_Registry.on_update<Component>().template connect<&Scene::OnComponentChanged<Component>>(*this), ...);
+	}
+
+	template<typename... Component>
+	void Scene::DisconnectChangeSignals(ComponentGroup<Component...>) {
+		(m_Registry.on_construct<Component>().template disconnect<&Scene::OnComponentChanged<Component>>(*this), ...);
+		(m_Registry.on_update<Component>().template disconnect<&Scene::OnComponentChanged<Component>>(*this), ...);
+	}
+
+	template<typename... Component>
+	void Scene::PrepareStorages(ComponentGroup<Component...>) {
+		(m_Registry.prepare<Component>(), ...);
+	}
+
+	template<typename T>
+	void Scene::AddStorageReport(SceneMemoryReport& report, const char* name) {
+		SceneMemoryReport::Storage storage;
+		storage.Name = name;
+		storage.Count = m_Registry.size<T>();
+		storage.Bytes = GetStorageBytes(ComponentGroup<T>{});
+
+		report.Storages.push_back(storage);
+		report.TotalBytes += storage.Bytes;
+	}
+
+	template<typename... Component>
+	size_t Scene::GetStorageBytes(ComponentGroup<Component...>) {
+		using Traits = entt::entt_traits<std::underlying_type_t<entt::entity>>;
+		constexpr size_t entitiesPerPage = ENTT_PAGE_SIZE / sizeof(entt::entity);
+
+		size_t bytes = 0;
+		([&]()
+			{
+				// Empty components only keep their entities
+				size_t componentSize = std::is_empty_v<Component> ? 0 : sizeof(Component);
+				bytes += m_Registry.capacity<Component>() * (componentSize + sizeof(entt::entity));
+
+				// Sparse pages are allocated up to the highest entity index the storage has seen, this counts the live ones
+				const entt::entity* entities = m_Registry.data<Component>();
+				size_t highest = 0;
+				for (size_t i = 0; i < m_Registry.size<Component>(); i++)
+					highest = std::max<size_t>(highest, entt::to_integral(entities[i]) & Traits::entity_mask);
+
+				if (m_Registry.size<Component>() > 0)
+					bytes += (highest / entitiesPerPage + 1) * ENTT_PAGE_SIZE;
+			}(), ...);
+
+		return bytes;
+	}
+
+	Scene::Scene() {
+		m_Epoch = ++s_SceneEpoch;
+
+		ConnectChangeSignals(TrackedComponents{});
+
+		m_Registry.on_construct<TagComponent>().connect<&Scene::OnTagConstruct>(*this);
+		m_Registry.on_update<TagComponent>().connect<&Scene::OnTagUpdate>(*this);
+		m_Registry.on_destroy<TagComponent>().connect<&Scene::OnTagDestroy>(*this);
+
+		m_Registry.on_destroy<PooledComponent>().connect<&Scene::OnPooledDestroy>(*this);
+
+		// Creating a storage while systems run on other threads would race, so every one the systems view exists up front
+		PrepareStorages(AllComponents{});
+		PrepareStorages(ComponentGroup<ParentChildComponent, DisabledTag>{});
+		PrepareStorages(VersionsOf(TrackedComponents{}));
+		// The same goes for the groups, which also sort their pools as they are created
+		GetSpriteGroup();
+		GetCircleGroup();
+		GetStringGroup();
+		GetBodyGroup();
+		AddEngineSystems();
+	}
 
 	Scene::~Scene() {
 		DestroyPhysics();
 	}
 
 	Ref<Scene> Scene::Copy(Ref<Scene> other) {
+		NB_PROFILE_FUNCTION();
+
 		Ref<Scene> newScene = CreateRef<Scene>();
 		newScene->m_ViewportWidth = other->m_ViewportWidth;
 		newScene->m_ViewportHeight = other->m_ViewportHeight;
 
-		std::unordered_map<UUID, entt::entity> enttMap;
-
 		auto& srcSceneReg = other->m_Registry;
 		auto& dstSceneReg = newScene->m_Registry;
-		auto idView = srcSceneReg.view<IDComponent>();
 
-		Array<entt::entity> entityVec;
+		// A fresh copy has no changes yet, stamps are added the first time something is marked
+		newScene->DisconnectChangeSignals(TrackedComponents{});
+		// The tag index is copied whole below instead of being refilled tag by tag
+		dstSceneReg.on_construct<TagComponent>().disconnect<&Scene::OnTagConstruct>(*newScene);
 
-		for (auto e : idView)
-			entityVec.push_back(e);
+		// Entity identifiers are kept, so the UUID map, tag index and hierarchy links stay valid as they are
+		dstSceneReg.assign(srcSceneReg.data(), srcSceneReg.data() + srcSceneReg.size());
+		CloneStorage(ComponentGroup<IDComponent, ParentChildComponent, TagComponent>{}, dstSceneReg, srcSceneReg);
+		CloneStorage(AllComponents{}, dstSceneReg, srcSceneReg);
+		CloneStorage<DisabledTag>(dstSceneReg, srcSceneReg);
 
-		for (size_t i = entityVec.size(); i; i--) {
-			UUID uuid = srcSceneReg.get<IDComponent>(entityVec[i - 1]).ID;
-			const auto& name = srcSceneReg.get<TagComponent>(entityVec[i -1]).Tag;
-			Entity newEnt = newScene->CreateEntity(uuid, name);
-			enttMap[uuid] = (entt::entity)newEnt;
-		}
-
-		CopyComponent(AllComponents{}, dstSceneReg, srcSceneReg, enttMap);
-		CopyComponent(ComponentGroup<ParentChildComponent>{}, dstSceneReg, srcSceneReg, enttMap);
+		dstSceneReg.on_construct<TagComponent>().connect<&Scene::OnTagConstruct>(*newScene);
+		newScene->ConnectChangeSignals(TrackedComponents{});
 
-		newScene->m_SceneOrder = other->m_SceneOrder;
+		newScene->m_EntityMap = other->m_EntityMap;
+		newScene->m_TagIndex = other->m_TagIndex;
+		newScene->m_RootLinks = other->m_RootLinks;
+		newScene->m_TransformHierarchy = other->m_TransformHierarchy;
+		newScene->m_TransformDepths = other->m_TransformDepths;
+		newScene->m_TransformHierarchyOutdated = other->m_TransformHierarchyOutdated;
 
 		return newScene;
 	}
 
+	SceneMemoryReport Scene::GetMemoryReport() {
+		NB_PROFILE_FUNCTION();
+
+		SceneMemoryReport report;
+		report.EntityCount = m_Registry.alive();
+		report.TotalBytes = m_Registry.capacity() * sizeof(entt::entity);
+
+		AddStorageReport<IDComponent>(report, "ID");
+		AddStorageReport<TagComponent>(report, "Tag");
+		AddStorageReport<PropertiesComponent>(report, "Properties");
+		AddStorageReport<DisabledTag>(report, "Disabled");
+		AddStorageReport<ParentChildComponent>(report, "Parent Child");
+		AddStorageReport<PooledComponent>(report, "Pooled");
+		AddStorageReport<TransformComponent>(report, "Transform");
+		AddStorageReport<WorldTransformComponent>(report, "World Transform");
+		AddStorageReport<CameraComponent>(report, "Camera");
+		AddStorageReport<ScriptComponent>(report, "Script");
+		AddStorageReport<NativeScriptComponent>(report, "Native Script");
+		AddStorageReport<SpriteRendererComponent>(report, "Sprite Renderer");
+		AddStorageReport<CircleRendererComponent>(report, "Circle Renderer");
+		AddStorageReport<StringRendererComponent>(report, "String Renderer");
+		AddStorageReport<Rigidbody2DComponent>(report, "Rigidbody 2D");
+		AddStorageReport<BoxCollider2DComponent>(report, "Box Collider 2D");
+		AddStorageReport<CircleColliderComponent>(report, "Circle Collider");
+
+		// One storage of ComponentVersion<T> per tracked T, reported together
+		SceneMemoryReport::Storage versions;
+		versions.Name = "Change Versions";
+		versions.Bytes = GetStorageBytes(VersionsOf(TrackedComponents{}));
+		report.Storages.push_back(versions);
+		report.TotalBytes += versions.Bytes;
+
+		return report;
+	}
+
 	Entity Scene::CreateEntity(std::string_view name) {
 		return CreateEntity(UUID(), name);
 	}
 
 	Entity Scene::CreateEntity(UUID uuid, std::string_view name) {
 		Entity entity = { m_Registry.create(), this };
-		m_SceneOrder.push_back(uuid); 
+		m_PickerOutdated = true;
+		m_TransformHierarchyOutdated = true;
 		m_EntityMap[uuid] = entity;
 
 		entity.AddComponent<TransformComponent>();
 		entity.AddComponent<WorldTransformComponent>();
 		entity.AddComponent<ParentChildComponent>();
+		AttachChild(entt::null, entity, m_RootLinks.LastChild);
 
 		auto& idc = entity.AddComponent<IDComponent>();
 		idc.ID = uuid;
-		
-		const ProjectConfig& pConfig = Project::GetActive()->GetConfig();
 
-		auto& prop = entity.AddComponent<PropertiesComponent>();
-		prop.Layer = pConfig.Layers.at(1);
+		entity.AddComponent<PropertiesComponent>();
 
-		auto& tag = entity.AddComponent<TagComponent>();
-		tag.Tag = name.empty() ? "Entity" : name;
+		entity.AddComponent<TagComponent>(name.empty() ? NameID("Entity") : NameID(name));
 		
 		return entity;
 	}
 
-	Entity Scene::DuplicateEntity(Entity entity, bool duplicateIntoParent) {
-		std::string name = entity.GetName();
-		Entity duplicated = CreateEntity(name);
+	Entity Scene::CopyEntity(Entity source) {
+		Entity entity = CreateEntity(source.GetName());
 
-		CopyComponent(AllComponents{}, duplicated, entity);
+		CopyComponent(AllComponents{}, entity, source);
+		entity.SetEnabled(source.IsEnabled());
+		entity.MarkTransformDirty();
 
-		const UUID& duplicatedID = duplicated.GetUUID();
+		return entity;
+	}
 
-		ParentChildComponent& pcc = entity.GetParentChild();
-		if (pcc.Parent && duplicateIntoParent)
-		{
-			duplicated.GetParentChild().Parent = pcc.Parent;
-			
-			Entity parent = { pcc.Parent, this };
-			parent.GetParentChild().AddChild(duplicatedID);
+	Entity Scene::DuplicateEntity(Entity entity, bool duplicateIntoParent) {
+		Entity duplicated = CopyEntity(entity);
 
-			m_SceneOrder.remove(duplicatedID);
-		}
+		Entity parent = entity.GetParent();
+		if (parent && duplicateIntoParent)
+			SetParent(duplicated, parent);
 		
-		for (uint32_t i = 0; i < entity.GetParentChild().ChildrenIDs.size(); i++)
-		{
-			Entity child = DuplicateEntity({ entity.GetParentChild().ChildrenIDs[i], this }, false);
-			UUID childID = child.GetUUID();
+		for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
+			SetParent(DuplicateEntity(child, false), duplicated);
 
-			duplicated.GetParentChild().AddChild(childID);
-			child.GetParentChild().Parent = duplicatedID;
-			m_SceneOrder.remove(childID);
-		}
-		
 		if (m_IsRunning && entity.HasComponent<Rigidbody2DComponent>())
 			CreateBox2DBody(duplicated);
 		
@@ -165,50 +276,91 @@ namespace Nebula {
 		if (!entity)
 			return;
 		
-		UUID entityID = entity.GetUUID();
+		if (m_DestroyQueued.insert(entity).second)
+			m_DestroyQueue.push_back(entity);
 
-		if (m_ContactListener && m_ContactListener->IsFlushing())
-		{
-			m_ContactListener->DeleteEntity(entityID);
-			return;
-		}
+		// Outside of play and simulation there are no script or physics callbacks to get in the way
+		if (!m_PhysicsWorld)
+			FlushDestroyQueue();
+	}
 
-		if (entity.HasComponent<NativeScriptComponent>())
+	void Scene::FlushDestroyQueue() {
+		// Script and contact callbacks can queue more entities, so keep going until nothing is left
+		while (!m_DestroyQueue.empty())
 		{
-			auto nsc = entity.GetComponent<NativeScriptComponent>();
-			entity.GetComponent<NativeScriptComponent>().DestroyScript(&nsc);
-		}
+			NB_PROFILE_SCOPE("Scene::FlushDestroyQueue - Batch");
 
-		if (entity.HasComponent<Rigidbody2DComponent>())
-		{
-			Rigidbody2DComponent& rb2d = entity.GetComponent<Rigidbody2DComponent>();
-			if (b2Body* body = (b2Body*)rb2d.RuntimeBody)
+			Array<entt::entity> batch;
+			std::swap(batch, m_DestroyQueue);
+
+			// Children go with their parents, the batch grows while it is walked
+			for (size_t i = 0; i < batch.size(); i++)
 			{
-				Entity* entity = (Entity*)body->GetUserData().pointer;
-				
-				m_PhysicsWorld->DestroyBody(body);
-				rb2d.RuntimeBody = nullptr;
+				auto& links = m_Registry.get<ParentChildComponent>(batch[i]);
+				for (entt::entity child = links.FirstChild; child != entt::null; child = m_Registry.get<ParentChildComponent>(child).NextSibling)
+				{
+					if (m_DestroyQueued.insert(child).second)
+						batch.push_back(child);
+				}
+			}
+
+			// Box2D reports the broken contacts while the bodies are destroyed, the listener calls the scripts straight away
+			if (m_PhysicsWorld)
+			{
+				m_ContactListener->SetDeletingEntities(true);
+
+				auto bodies = m_Registry.view<Rigidbody2DComponent>();
+				for (entt::entity e : batch)
+				{
+					if (!bodies.contains(e))
+						continue;
+
+					auto& rb2d = bodies.get<Rigidbody2DComponent>(e);
+					if (b2Body* body = (b2Body*)rb2d.RuntimeBody)
+					{
+						UUID* userData = (UUID*)body->GetUserData().pointer;
 
-				delete entity;
+						m_PhysicsWorld->DestroyBody(body);
+						rb2d.RuntimeBody = nullptr;
+
+						delete userData;
+					}
+				}
+
+				m_ContactListener->SetDeletingEntities(false);
 			}
-		}
-		
-		auto& Parent = entity.GetParentChild();
-		size_t size = Parent.ChildrenIDs.size();
-		for (size_t i = 0; i < size; i++)
-			DestroyEntity({ Parent.ChildrenIDs[0], this});
 
-		if (Parent.Parent) 
-		{
-			Entity parent = { Parent.Parent, this };
-			parent.GetParentChild().RemoveChild(entityID);
-		}
+			// After the bodies, the exit callbacks above still run on these instances
+			auto nativeScripts = m_Registry.view<NativeScriptComponent>();
+			for (entt::entity e : batch)
+			{
+				if (!nativeScripts.contains(e))
+					continue;
+
+				auto& nsc = nativeScripts.get<NativeScriptComponent>(e);
+				if (nsc.Instance)
+					nsc.DestroyScript(&nsc);
+			}
+
+			for (entt::entity e : batch)
+			{
+				// Only the top of each destroyed subtree has to leave its siblings
+				entt::entity parent = m_Registry.get<ParentChildComponent>(e).Parent;
+				if (parent == entt::null || !m_DestroyQueued.count(parent))
+					DetachChild(e);
+
+				UUID entityID = m_Registry.get<IDComponent>(e).ID;
+				ScriptEngine::DeleteScriptInstance(entityID);
+				m_EntityMap.erase(entityID);
+			}
 
-		ScriptEngine::DeleteScriptInstance(entityID);
+			for (entt::entity e : batch)
+				m_DestroyQueued.erase(e);
 
-		m_SceneOrder.remove(entityID);
-		m_EntityMap.erase(entityID);
-		m_Registry.destroy(entity);
+			m_Registry.destroy(batch.begin(), batch.end());
+			m_PickerOutdated = true;
+			m_TransformHierarchyOutdated = true;
+		}
 	}
 
 	Entity Scene::GetPrimaryCamera() {
@@ -225,38 +377,70 @@ namespace Nebula {
 	}
 
 	Entity Scene::GetEntityWithTag(std::string_view tag) {
-		auto view = m_Registry.view<TagComponent>();
-
-		for (auto& entity : view) {
-			const TagComponent& tc = view.get<TagComponent>(entity);
-
-			if (tc.Tag == tag)
-				return Entity(entity, this);
+		// A name nothing has interned can't be anyone's tag
+		NameID name;
+		if (NameID::Find(tag, name)) {
+			const Array<entt::entity>& entities = m_TagIndex.Find(name);
+			if (!entities.empty())
+				return Entity(entities.front(), this);
 		}
 
 		NB_ERROR("Could Not Find Entity with name {0}", tag);
 		return {};
 	}
 
+	Entity Scene::GetChildWithTag(Entity parent, std::string_view tag) {
+		NameID name;
+		if (!NameID::Find(tag, name))
+			return {};
+
+		const Array<entt::entity>& children = m_TagIndex.FindChildren(parent, name);
+		return children.empty() ? Entity() : Entity(children.front(), this);
+	}
+
 	Entity Scene::GetEntityWithUUID(UUID id) {
 		auto it = m_EntityMap.find(id);
-		NB_ASSERT(it == m_EntityMap.end(), "Could Not Find Entity UUID");
+		NB_ASSERT(it != m_EntityMap.end(), "Could Not Find Entity UUID");
 
 		return { it->second, this };
 	}
 
+	Entity Scene::PickEntity(const glm::mat4& viewProjection, const glm::vec2& ndc) {
+		NB_PROFILE_FUNCTION();
+
+		// Components can be edited from any panel or script, the change tracker sees all of them
+		uint64_t version = std::max({
+			GetComponentVersion<TransformComponent>(),
+			GetComponentVersion<SpriteRendererComponent>(),
+			GetComponentVersion<CircleRendererComponent>(),
+			GetComponentVersion<StringRendererComponent>()
+		});
+
+		if (m_PickerOutdated || version > m_PickerVersion) {
+			m_Picker.Rebuild(m_Registry);
+			m_PickerOutdated = false;
+			m_PickerVersion = GetChangeVersion();
+		}
+
+		entt::entity handle = m_Picker.Pick(viewProjection, ndc);
+		if (handle == entt::null || !m_Registry.valid(handle))
+			return {};
+
+		return { handle, this };
+	}
+
 	void Scene::CreateBox2DBody(Entity entity) {
-		auto& world = entity.GetComponent<WorldTransformComponent>();
+		auto& world = entity.GetWorldTransform();
 		auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
 		auto& prop = entity.GetComponent<PropertiesComponent>();
 
-		glm::vec3 translation, rotation, scale;
-		Maths::DecomposeTransform(world.Transform, translation, rotation, scale);
+		glm::vec3 translation = world.GetTranslation();
+		glm::vec2 scale = world.Scale;
 
 		b2BodyDef bodyDef;
 		bodyDef.type = Utils::Rigibody2DToBox2D(rb2d.Type);
 		bodyDef.position.Set(translation.x, translation.y);
-		bodyDef.angle = rotation.z;
+		bodyDef.angle = world.Rotation;
 		bodyDef.fixedRotation = rb2d.FixedRotation;
 
 		b2BodyUserData data;
@@ -281,7 +465,7 @@ namespace Nebula {
 			fixtureDef.restitutionThreshold = bc2d.RestitutionThreshold;
 
 			fixtureDef.isSensor = rb2d.Trigger;
-			fixtureDef.filter.categoryBits = prop.Layer->Identity;
+			fixtureDef.filter.categoryBits = prop.Layer;
 			fixtureDef.filter.maskBits = bc2d.Mask;
 			
 			bc2d.RuntimeFixture = body->CreateFixture(&fixtureDef);
@@ -302,7 +486,7 @@ namespace Nebula {
 			fixtureDef.restitutionThreshold = cc.RestitutionThreshold;
 
 			fixtureDef.isSensor = rb2d.Trigger;
-			fixtureDef.filter.categoryBits = prop.Layer->Identity;
+			fixtureDef.filter.categoryBits = prop.Layer;
 			fixtureDef.filter.maskBits = cc.Mask;
 
 			cc.RuntimeFixture = body->CreateFixture(&fixtureDef);
@@ -314,17 +498,17 @@ namespace Nebula {
 		if (!m_IsRunning)
 			return;
 
-		auto& world = entity.GetComponent<WorldTransformComponent>();
+		auto& world = entity.GetWorldTransform();
 		auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
 		auto& prop = entity.GetComponent<PropertiesComponent>();
 
-		glm::vec3 translation, rotation, scale;
-		Maths::DecomposeTransform(world.Transform, translation, rotation, scale);
+		glm::vec3 translation = world.GetTranslation();
+		glm::vec2 scale = world.Scale;
 
 		b2Body* body = (b2Body*)rb2d.RuntimeBody;
 		body->SetEnabled(prop.Enabled);
 		body->SetType(Utils::Rigibody2DToBox2D(rb2d.Type));
-		body->SetTransform({ translation.x, translation.y }, rotation.z);
+		body->SetTransform({ translation.x, translation.y }, world.Rotation);
 		body->SetFixedRotation(rb2d.FixedRotation);
 
 		if (entity.HasComponent<BoxCollider2DComponent>()) {
@@ -352,7 +536,7 @@ namespace Nebula {
 			polygonShape->SetAsBox(scale.x * bc2d.Size.x, scale.y * bc2d.Size.y, b2Vec2(bc2d.Offset.x, bc2d.Offset.y), 0.0f);
 
 			b2Filter filter;
-			filter.categoryBits = prop.Layer->Identity;
+			filter.categoryBits = prop.Layer;
 			filter.maskBits = bc2d.Mask;
 			fixture->SetFilterData(filter);
 		}
@@ -384,7 +568,7 @@ namespace Nebula {
 			circle->m_radius = cc.Radius * scale.x;
 
 			b2Filter filter;
-			filter.categoryBits = prop.Layer->Identity;
+			filter.categoryBits = prop.Layer;
 			filter.maskBits = cc.Mask;
 			fixture->SetFilterData(filter);
 		}
@@ -407,16 +591,43 @@ namespace Nebula {
 	}
 
 	void Scene::UpdatePhysics() {
+		auto bodies = GetBodyGroup();
+		const entt::entity* bodyEntities = bodies.data<Rigidbody2DComponent>();
+		Rigidbody2DComponent* rigidbodies = bodies.raw<Rigidbody2DComponent>();
+
+		// Only bodies whose entity moved since the last step are synced. Resolving flags the ones edited this frame,
+		// anything moved earlier was flagged by UpdateTransforms()
+		for (size_t i = 0; i < bodies.size(); i++) {
+			Entity entity = { bodyEntities[i], this };
+			auto& rb2d = rigidbodies[i];
+
+			ResolveTransform(entity);
+			bool moved = rb2d.RuntimeMoved;
+			rb2d.RuntimeMoved = false;
+
+			if (!rb2d.RuntimeBody)
+				CreateBox2DBody(entity);
+			else if (moved)
+				entity.UpdatePhysicsBody();
+		}
+
 		m_PhysicsWorld->Step(Time::DeltaTime(), 6, 2);
 		m_ContactListener->Flush();
 
-		auto view = m_Registry.view<Rigidbody2DComponent>();
-		for (auto e : view) {
-			Entity entity = { e, this };
+		// Anything destroyed by the scripts or their collision callbacks leaves before the bodies are read back
+		FlushDestroyQueue();
+
+		// The flush may have shuffled the group
+		bodyEntities = bodies.data<Rigidbody2DComponent>();
+		rigidbodies = bodies.raw<Rigidbody2DComponent>();
+
+		for (size_t i = 0; i < bodies.size(); i++) {
+			Entity entity = { bodyEntities[i], this };
 			
-			auto& world = entity.GetComponent<WorldTransformComponent>();
+			// A parent earlier in the group may have moved this frame
+			auto& world = entity.GetWorldTransform();
 			auto& transform = entity.GetComponent<TransformComponent>();
-			auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
+			auto& rb2d = rigidbodies[i];
 
 			if (!rb2d.RuntimeBody)
 				CreateBox2DBody(entity);
@@ -424,14 +635,13 @@ namespace Nebula {
 			b2Body* body = (b2Body*)rb2d.RuntimeBody;
 			auto position = body->GetPosition();
 
-			glm::vec3 wTranslation, wRotation, wScale;
-			Maths::DecomposeTransform(world.Transform, wTranslation, wRotation, wScale);
+			glm::vec3 wTranslation = world.GetTranslation();
 			
 			transform.Translation.x += position.x - wTranslation.x;
 			transform.Translation.y += position.y - wTranslation.y;
-			transform.Rotation.z += body->GetAngle() - wRotation.z;
+			transform.Rotation.z += body->GetAngle() - world.Rotation;
 
-			entity.UpdateTransform();
+			entity.MarkTransformDirty();
 		}
 	}
 
@@ -441,7 +651,7 @@ namespace Nebula {
 			Entity entity = { e, this };
 			auto& rb2d = entity.GetComponent<Rigidbody2DComponent>();
 			if (rb2d.RuntimeBody) {
-				delete (Entity*)((b2Body*)rb2d.RuntimeBody)->GetUserData().pointer;
+				delete (UUID*)((b2Body*)rb2d.RuntimeBody)->GetUserData().pointer;
 				rb2d.RuntimeBody = nullptr;
 			}
 		}
@@ -470,23 +680,24 @@ namespace Nebula {
 			ScriptEngine::CreateScriptInstance(entity);
 		}
 
-		for (auto e : view)
+		auto enabledView = m_Registry.view<ScriptComponent>(entt::exclude<DisabledTag>);
+		for (auto e : enabledView)
 		{
 			Entity entity = { e, this };
-			if (entity.IsEnabled())
-				ScriptEngine::OnCreateEntity(entity);
+			ScriptEngine::OnCreateEntity(entity);
 		}
 	}
 
 	void Scene::UpdateScripts() {
-		auto scriptView = m_Registry.view<ScriptComponent>();
+		auto scriptView = m_Registry.view<ScriptComponent>(entt::exclude<DisabledTag>);
 		for (auto e : scriptView)
 		{
 			Entity entity = { e, this };
-			if (entity.IsEnabled())
-				ScriptEngine::OnUpdateEntity(entity, Time::DeltaTime());
+			ScriptEngine::OnUpdateEntity(entity, Time::DeltaTime());
 		}
-		
+	}
+
+	void Scene::UpdateNativeScripts() {
 		auto nativeScriptView = m_Registry.view<NativeScriptComponent>();
 		for (auto e : nativeScriptView)
 		{
@@ -522,6 +733,7 @@ namespace Nebula {
 	void Scene::OnRuntimeStart() {
 		m_IsRunning = true;
 
+		UpdateTransforms();
 		InitPhysics();
 		InitScripts();
 	}
@@ -530,81 +742,218 @@ namespace Nebula {
 		m_IsRunning = false;
 
 		DestroyScripts();
+		FlushDestroyQueue();
 		DestroyPhysics();
 	}
 
 	void Scene::UpdateRuntime() {
+		m_ChangeTracker.NextFrame();
+
+		// Pick up anything destroyed while paused or between frames
+		FlushDestroyQueue();
+
 		if (m_IsPaused && m_StepFrames-- <= 0)
+		{
+			// Edits made while paused still have to show up, the camera may have been among them
+			UpdateTransforms();
+			FindPrimaryCamera();
+			ExtractRenderPackets();
 			return;
+		}
+
+		m_Systems.Run(*this);
+	}
+
+	void Scene::AddEngineSystems() {
+		// Scripts and physics can reach any component and destroy entities, so nothing runs alongside them
+		m_Systems.Add("Scripts", SystemStage::Update, SystemAccess().All().OnMainThread(), [](Scene& scene) { scene.UpdateScripts(); });
+		m_Systems.Add("Native Scripts", SystemStage::Update, SystemAccess().All().OnMainThread(), [](Scene& scene) { scene.UpdateNativeScripts(); });
+
+		// Physics resolves the bodies the scripts moved on its own, so the world transforms are only updated once, afterwards
+		m_Systems.Add("Physics", SystemStage::Physics, SystemAccess().All().OnMainThread(), [](Scene& scene) { scene.UpdatePhysics(); });
+
+		// Moved bodies are only flagged here, Box2D is synced by the physics system on the main thread
+		SystemAccess transforms = SystemAccess()
+			.Read<TransformComponent, ParentChildComponent>()
+			.Write<WorldTransformComponent, Rigidbody2DComponent>();
+		m_Systems.Add("World Transforms", SystemStage::Late, transforms, [](Scene& scene) { scene.UpdateTransforms(); });
+		// Runs after the world transforms, so a parented camera renders from where it ended up this frame.
+		// Picking the primary camera counts as a write, so extraction waits for it
+		m_Systems.Add("Camera", SystemStage::Late, SystemAccess().Read<WorldTransformComponent>().Write<CameraComponent>(), [](Scene& scene) { scene.FindPrimaryCamera(); });
+
+		// Textures and fonts come from the asset manager, which may have to create them
+		SystemAccess extraction = SystemAccess()
+			.Read<TransformComponent, WorldTransformComponent, CameraComponent>()
+			.Read<SpriteRendererComponent, CircleRendererComponent, StringRendererComponent>()
+			.OnMainThread();
+		m_Systems.Add("Render Extraction", SystemStage::Extract, extraction, [](Scene& scene) { scene.ExtractRenderPackets(); });
+	}
+
+	void Scene::FindPrimaryCamera() {
+		// Cleared first, the last primary camera may have been destroyed or demoted
+		mainCam = nullptr;
 
-		auto camView = m_Registry.view<TransformComponent, CameraComponent>();
+		auto camView = m_Registry.view<WorldTransformComponent, CameraComponent>();
 		for (auto entity : camView) {
-			auto [transform, camera] = camView.get<TransformComponent, CameraComponent>(entity);
+			auto [world, camera] = camView.get<WorldTransformComponent, CameraComponent>(entity);
 
 			if (camera.Primary) {
 				mainCam = &camera.Camera;
-				mainCamTransform = transform;
+				mainCamTransform = world.Transform.ToMat4();
 				break;
 			}
 		}
+	}
 
-		UpdateScripts();
-		UpdatePhysics();
+	void Scene::ExtractRenderPackets() {
+		NB_PROFILE_FUNCTION();
+
+		RenderPacketBuffer& packets = m_RenderPackets[m_ExtractIndex];
+
+		packets.HasCamera = mainCam != nullptr;
+		if (mainCam) {
+			packets.CameraProjection = mainCam->GetProjection();
+			packets.CameraTransform = mainCamTransform;
+		}
+
+		FillRenderPackets(packets);
+		m_ExtractIndex ^= 1;
 	}
 
-	void Scene::RenderRuntime() {
-		if (!mainCam) return;
+	void Scene::FillRenderPackets(RenderPacketBuffer& packets) {
+		NB_PROFILE_FUNCTION();
+
+		// The group's first size() components of both pools line up, so sprites are read straight from the arrays
+		auto sprites = GetSpriteGroup();
+		const entt::entity* spriteEntities = sprites.data<SpriteRendererComponent>();
+		const WorldTransformComponent* spriteWorlds = sprites.raw<WorldTransformComponent>();
+		const SpriteRendererComponent* spriteRenderers = sprites.raw<SpriteRendererComponent>();
 
-		Renderer2D::BeginScene(*mainCam, mainCamTransform);
+		packets.Sprites.resize(sprites.size());
+
+		// Neighbouring sprites tend to share a texture
+		AssetHandle lastHandle = NULL;
+		Ref<Texture2D> lastTexture;
+
+		for (size_t i = 0; i < sprites.size(); i++) {
+			const SpriteRendererComponent& sprite = spriteRenderers[i];
+			SpritePacket& packet = packets.Sprites[i];
+
+			packet.Transform = spriteWorlds[i].Transform.ToMat4();
+			packet.Colour = sprite.Colour;
+			packet.Tiling = sprite.Tiling;
+			packet.Depth = packet.Transform[3].z;
+			packet.EntityID = (uint32_t)spriteEntities[i];
+
+			if (sprite.Texture != lastHandle) {
+				lastHandle = sprite.Texture;
+				lastTexture = AssetManager::GetAsset<Texture2D>(sprite.Texture);
+			}
+
+			if (!lastTexture || !lastTexture->IsLoaded()) {
+				packet.Texture = nullptr;
+				packet.UVRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+				continue;
+			}
 
-		auto group = m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-		for (auto id : group) {
-			Entity entity = { id, this };
+			// Matches SubTexture2D::CreateFromCoords
+			glm::vec2 size = { (float)lastTexture->GetWidth(), (float)lastTexture->GetHeight() };
+			glm::vec2 min = sprite.SubTextureOffset * sprite.SubTextureCellSize / size;
+			glm::vec2 max = (sprite.SubTextureOffset + sprite.SubTextureCellNum) * sprite.SubTextureCellSize / size;
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_QUAD, entity);
+			packet.Texture = lastTexture;
+			packet.UVRect = glm::vec4(min, max);
 		}
 
-		auto CircleGroup = m_Registry.view<CircleRendererComponent>();
-		for (auto id : CircleGroup) {
-			Entity entity = { id, this };
+		// World transforms are owned by the sprite group, circles and text look theirs up
+		auto circles = GetCircleGroup();
+		const entt::entity* circleEntities = circles.data<CircleRendererComponent>();
+		const CircleRendererComponent* circleRenderers = circles.raw<CircleRendererComponent>();
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_CIRCLE, entity);
+		packets.Circles.resize(circles.size());
+		for (size_t i = 0; i < circles.size(); i++) {
+			const CircleRendererComponent& circle = circleRenderers[i];
+			glm::mat4 transform = circles.get<WorldTransformComponent>(circleEntities[i]).Transform.ToMat4();
+
+			packets.Circles[i] = { transform, circle.Colour, circle.Thickness, circle.Fade, transform[3].z, (uint32_t)circleEntities[i] };
+		}
+
+		// Assigned in place, so the text keeps its allocation from earlier frames
+		auto strings = GetStringGroup();
+		const entt::entity* stringEntities = strings.data<StringRendererComponent>();
+		StringRendererComponent* stringRenderers = strings.raw<StringRendererComponent>();
+
+		packets.Strings.resize(strings.size());
+		for (size_t i = 0; i < strings.size(); i++) {
+			StringRendererComponent& stringRenderer = stringRenderers[i];
+			StringPacket& packet = packets.Strings[i];
+
+			packet.Transform = strings.get<WorldTransformComponent>(stringEntities[i]).Transform.ToMat4();
+			packet.Text = stringRenderer.Text;
+			packet.Font = stringRenderer.GetFont();
+			packet.Colour = stringRenderer.Colour;
+			packet.Kerning = stringRenderer.Kerning;
+			packet.LineSpacing = stringRenderer.LineSpacing;
+			packet.EntityID = (uint32_t)stringEntities[i];
 		}
 
+		auto backToFront = [](const auto& a, const auto& b) { return a.Depth < b.Depth; };
+		std::stable_sort(packets.Sprites.begin(), packets.Sprites.end(), backToFront);
+		std::stable_sort(packets.Circles.begin(), packets.Circles.end(), backToFront);
+	}
+
+	void Scene::DrawRenderPackets(const RenderPacketBuffer& packets) {
+		for (const SpritePacket& sprite : packets.Sprites)
+			Renderer2D::Draw(sprite);
+
+		for (const CirclePacket& circle : packets.Circles)
+			Renderer2D::Draw(circle);
+	}
+
+	void Scene::RenderRuntime() {
+		const RenderPacketBuffer& packets = GetRenderPackets();
+		if (!packets.HasCamera) return;
+
+		Renderer2D::BeginScene(Camera(packets.CameraProjection), packets.CameraTransform);
+		DrawRenderPackets(packets);
 		Renderer2D::EndScene();
 	}
 
 	void Scene::RenderRuntimeOverlay() {
-		if (!mainCam) return;
+		const RenderPacketBuffer& packets = GetRenderPackets();
+		if (!packets.HasCamera) return;
 
-		Renderer2D::BeginScene(*mainCam, mainCamTransform);
+		Renderer2D::BeginScene(Camera(packets.CameraProjection), packets.CameraTransform);
 		
-		auto StringGroup = m_Registry.view<StringRendererComponent>();
-		for (auto id : StringGroup) {
-			Entity entity = { id, this };
-
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_STRING, entity);
-		}
+		for (const StringPacket& text : packets.Strings)
+			Renderer2D::Draw(text);
 
 		Renderer2D::EndScene();
 	}
 
 	void Scene::OnSimulationStart() {
+		UpdateTransforms();
 		InitPhysics();
 	}
 
 	void Scene::OnSimulationStop() {
+		FlushDestroyQueue();
 		DestroyPhysics();
 	}
 
 	void Scene::UpdateSimulation() {
+		m_ChangeTracker.NextFrame();
+
+		FlushDestroyQueue();
+
 		if (m_IsPaused && m_StepFrames-- <= 0)
+		{
+			UpdateTransforms();
 			return;
+		}
 
 		UpdatePhysics();
+		UpdateTransforms();
 	}
 
 	void Scene::Step(int frames)
@@ -615,76 +964,265 @@ namespace Nebula {
 		m_StepFrames = frames;
 	}
 
-	void Scene::UpdateEditor() { }
+	Entity Scene::GetFirstRoot() {
+		return { m_RootLinks.FirstChild, this };
+	}
 
-	void Scene::Render(EditorCamera& camera) {
-		Renderer2D::BeginScene(camera);
+	ParentChildComponent& Scene::GetLinks(entt::entity parent) {
+		return parent == entt::null ? m_RootLinks : m_Registry.get<ParentChildComponent>(parent);
+	}
 
-		auto group = m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-		for (auto id : group) {
-			Entity entity = { id, this };
+	void Scene::AttachChild(entt::entity parent, entt::entity child, entt::entity after) {
+		auto& parentLinks = GetLinks(parent);
+		auto& childLinks = m_Registry.get<ParentChildComponent>(child);
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_QUAD, entity);
-		}
+		childLinks.Parent = parent;
+		childLinks.PrevSibling = after;
+		childLinks.NextSibling = after != entt::null ? m_Registry.get<ParentChildComponent>(after).NextSibling : parentLinks.FirstChild;
+
+		if (childLinks.PrevSibling != entt::null)
+			m_Registry.get<ParentChildComponent>(childLinks.PrevSibling).NextSibling = child;
+		else
+			parentLinks.FirstChild = child;
+
+		if (childLinks.NextSibling != entt::null)
+			m_Registry.get<ParentChildComponent>(childLinks.NextSibling).PrevSibling = child;
+		else
+			parentLinks.LastChild = child;
 
-		auto CircleGroup = m_Registry.view<CircleRendererComponent>();
-		for (auto id : CircleGroup) {
-			Entity entity = { id, this };
+		parentLinks.ChildCount++;
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_CIRCLE, entity);
+		if (m_Registry.has<TagComponent>(child))
+			m_TagIndex.AddChild(m_Registry, parent, child);
+	}
+
+	void Scene::DetachChild(entt::entity child) {
+		auto& childLinks = m_Registry.get<ParentChildComponent>(child);
+		auto& parentLinks = GetLinks(childLinks.Parent);
+
+		if (childLinks.PrevSibling != entt::null)
+			m_Registry.get<ParentChildComponent>(childLinks.PrevSibling).NextSibling = childLinks.NextSibling;
+		else
+			parentLinks.FirstChild = childLinks.NextSibling;
+
+		if (childLinks.NextSibling != entt::null)
+			m_Registry.get<ParentChildComponent>(childLinks.NextSibling).PrevSibling = childLinks.PrevSibling;
+		else
+			parentLinks.LastChild = childLinks.PrevSibling;
+
+		parentLinks.ChildCount--;
+
+		if (m_Registry.has<TagComponent>(child))
+			m_TagIndex.RemoveChild(m_Registry, child);
+		childLinks.Parent = childLinks.PrevSibling = childLinks.NextSibling = entt::null;
+	}
+
+	void Scene::SetParent(Entity entity, Entity parent) {
+		entt::entity parentHandle = entt::null;
+		if (parent)
+			parentHandle = parent;
+
+		if (entity.GetParentChild().Parent == parentHandle)
+			return;
+
+		DetachChild(entity);
+		AttachChild(parentHandle, entity, GetLinks(parentHandle).LastChild);
+
+		entity.MarkTransformDirty();
+		m_TransformHierarchyOutdated = true;
+	}
+
+	void Scene::MoveAfter(Entity entity, Entity sibling) {
+		if (entity == sibling)
+			return;
+
+		entt::entity parent = entity.GetParentChild().Parent;
+		entt::entity after = entt::null;
+		if (sibling)
+		{
+			NB_ASSERT(sibling.GetParentChild().Parent == parent, "Entities do not share a parent");
+			after = sibling;
 		}
 
-		Renderer2D::EndScene();
+		DetachChild(entity);
+		AttachChild(parent, entity, after);
+
+		m_TransformHierarchyOutdated = true;
 	}
 
-	void Scene::RenderOverlay(EditorCamera& camera) {
-		Renderer2D::BeginScene(camera);
+	static constexpr uint32_t s_NoParent = UINT32_MAX;
 
-		auto StringGroup = m_Registry.view<StringRendererComponent>();
-		for (auto id : StringGroup) {
-			Entity entity = { id, this };
+	void Scene::RebuildTransformHierarchy() {
+		NB_PROFILE_FUNCTION();
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_STRING, entity);
+		m_TransformHierarchy.clear();
+		m_TransformHierarchy.reserve(m_EntityMap.size());
+		m_TransformDepths.clear();
+
+		for (entt::entity root = m_RootLinks.FirstChild; root != entt::null; root = m_Registry.get<ParentChildComponent>(root).NextSibling)
+			m_TransformHierarchy.push_back({ root, s_NoParent });
+
+		// Breadth first, every parent is pushed before its children and each depth is contiguous
+		uint32_t depthEnd = 0;
+		for (uint32_t i = 0; i < m_TransformHierarchy.size(); i++)
+		{
+			if (i == depthEnd)
+			{
+				m_TransformDepths.push_back(i);
+				depthEnd = (uint32_t)m_TransformHierarchy.size();
+			}
+
+			entt::entity child = m_Registry.get<ParentChildComponent>(m_TransformHierarchy[i].Handle).FirstChild;
+			for (; child != entt::null; child = m_Registry.get<ParentChildComponent>(child).NextSibling)
+				m_TransformHierarchy.push_back({ child, i });
 		}
 
-		Renderer2D::EndScene();
+		m_TransformDepths.push_back((uint32_t)m_TransformHierarchy.size());
+		m_TransformHierarchyOutdated = false;
 	}
 
-	void Scene::Render(const Camera& camera, const glm::mat4& transform) {
-		Renderer2D::BeginScene(camera, transform);
+	void Scene::UpdateTransforms() {
+		NB_PROFILE_FUNCTION();
+
+		if (m_TransformHierarchyOutdated)
+			RebuildTransformHierarchy();
+
+		// Storages are fetched once, the jobs only touch components of their own nodes
+		auto worlds = m_Registry.view<WorldTransformComponent>();
+		auto locals = m_Registry.view<TransformComponent>();
+		auto rigidbodies = m_Registry.view<Rigidbody2DComponent>();
+		std::atomic<bool> updated = false;
+
+		auto updateNodes = [&](uint32_t begin, uint32_t end) {
+			bool anyUpdated = false;
+			for (uint32_t i = begin; i < end; i++)
+			{
+				TransformNode& node = m_TransformHierarchy[i];
+				auto& world = worlds.get(node.Handle);
+				const TransformNode* parent = node.Parent != s_NoParent ? &m_TransformHierarchy[node.Parent] : nullptr;
+
+				node.Updated = world.Dirty || (parent && parent->Updated);
+				if (!node.Updated)
+					continue;
+
+				Affine2D transform = locals.get(node.Handle).CalculateAffine();
+				if (parent)
+					transform = worlds.get(parent->Handle).Transform * transform;
 
-		auto group = m_Registry.group<TransformComponent>(entt::get<SpriteRendererComponent>);
-		for (auto id : group) {
-			Entity entity = { id, this };
+				world.SetTransform(transform);
+				world.Dirty = false;
+				anyUpdated = true;
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_QUAD, entity);
+				// Box2D is not thread safe, the body is synced by UpdatePhysics()
+				if (rigidbodies.contains(node.Handle))
+					rigidbodies.get(node.Handle).RuntimeMoved = true;
+			}
+
+			if (anyUpdated)
+				updated.store(true, std::memory_order_relaxed);
+		};
+
+		// A depth only reads the one above it, which is finished by then
+		for (uint32_t depth = 0; depth + 1 < m_TransformDepths.size(); depth++)
+		{
+			uint32_t begin = m_TransformDepths[depth], end = m_TransformDepths[depth + 1];
+			JobSystem::ParallelFor(end - begin, 1024, [&](uint32_t first, uint32_t last) { updateNodes(begin + first, begin + last); });
 		}
 
-		auto CircleGroup = m_Registry.view<CircleRendererComponent>();
-		for (auto id : CircleGroup) {
-			Entity entity = { id, this };
+		if (updated.load(std::memory_order_relaxed))
+			m_PickerOutdated = true;
+	}
+
+	bool Scene::ResolveTransform(entt::entity handle) {
+		auto& world = m_Registry.get<WorldTransformComponent>(handle);
+		const Affine2D* parentTransform = nullptr;
+		bool dirty = world.Dirty;
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_CIRCLE, entity);
+		entt::entity parent = m_Registry.get<ParentChildComponent>(handle).Parent;
+		if (parent != entt::null)
+		{
+			dirty |= ResolveTransform(parent);
+			parentTransform = &m_Registry.get<WorldTransformComponent>(parent).Transform;
 		}
 
+		if (!dirty)
+			return false;
+
+		Affine2D transform = m_Registry.get<TransformComponent>(handle).CalculateAffine();
+		world.SetTransform(parentTransform ? *parentTransform * transform : transform);
+		world.Dirty = false;
+
+		// Resolved once, UpdateTransforms() still has to reach the children and the body
+		for (entt::entity child = m_Registry.get<ParentChildComponent>(handle).FirstChild; child != entt::null; child = m_Registry.get<ParentChildComponent>(child).NextSibling)
+			m_Registry.get<WorldTransformComponent>(child).Dirty = true;
+
+		if (auto* rb2d = m_Registry.try_get<Rigidbody2DComponent>(handle))
+			rb2d->RuntimeMoved = true;
+
+		return true;
+	}
+
+	void Scene::OnTagConstruct(entt::registry& registry, entt::entity entity) {
+		m_TagIndex.Add(registry, entity);
+
+		if (const auto* links = registry.try_get<ParentChildComponent>(entity))
+			m_TagIndex.AddChild(registry, links->Parent, entity);
+	}
+
+	void Scene::OnTagUpdate(entt::registry& registry, entt::entity entity) {
+		m_TagIndex.RemoveChild(registry, entity);
+		m_TagIndex.Remove(registry, entity);
+
+		m_TagIndex.Add(registry, entity);
+		if (const auto* links = registry.try_get<ParentChildComponent>(entity))
+			m_TagIndex.AddChild(registry, links->Parent, entity);
+	}
+
+	void Scene::OnTagDestroy(entt::registry& registry, entt::entity entity) {
+		m_TagIndex.RemoveChild(registry, entity);
+		m_TagIndex.Remove(registry, entity);
+	}
+
+	void Scene::OnPooledDestroy(entt::registry& registry, entt::entity entity) {
+		m_PrefabPool.Remove(registry, entity);
+	}
+
+	void Scene::UpdateEditor() {
+		m_ChangeTracker.NextFrame();
+
+		UpdateTransforms();
+	}
+
+	void Scene::Render(EditorCamera& camera) {
+		FillRenderPackets(m_EditorPackets);
+
+		Renderer2D::BeginScene(camera);
+		DrawRenderPackets(m_EditorPackets);
 		Renderer2D::EndScene();
 	}
 
-	void Scene::RenderOverlay(const Camera& camera, const glm::mat4& transform) {
+	void Scene::RenderOverlay(EditorCamera& camera) {
+		Renderer2D::BeginScene(camera);
+
+		for (const StringPacket& text : m_EditorPackets.Strings)
+			Renderer2D::Draw(text);
+
+		Renderer2D::EndScene();
+	}
+
+	void Scene::Render(const Camera& camera, const glm::mat4& transform) {
+		FillRenderPackets(m_EditorPackets);
+
 		Renderer2D::BeginScene(camera, transform);
+		DrawRenderPackets(m_EditorPackets);
+		Renderer2D::EndScene();
+	}
 
-		auto StringGroup = m_Registry.view<StringRendererComponent>();
-		for (auto id : StringGroup) {
-			Entity entity = { id, this };
+	void Scene::RenderOverlay(const Camera& camera, const glm::mat4& transform) {
+		Renderer2D::BeginScene(camera, transform);
 
-			if (entity.IsEnabled())
-				Renderer2D::Draw(NB_STRING, entity);
-		}
+		for (const StringPacket& text : m_EditorPackets.Strings)
+			Renderer2D::Draw(text);
 
 		Renderer2D::EndScene();
 	}
@@ -3,8 +3,15 @@
 #include "entt.hpp"
 
 #include "Components.h"
+#include "Scene_Picker.h"
+#include "Scene_TagIndex.h"
+#include "Scene_PrefabPool.h"
+#include "Scene_ChangeTracker.h"
+#include "Scene_Systems.h"
 #include "Nebula/Renderer/Camera.h"
+#include "Nebula/Renderer/Render_Packets.h"
 #include "Nebula/Core/UUID.h"
+#include "Nebula/Utils/FlatHashMap.h"
 
 #include <map>
 
@@ -14,6 +21,22 @@ class b2Body;
 namespace Nebula {
 	class Entity;
 	class ContactListener;
+
+	// Bytes held by each component storage: the packed components and their entities plus the sparse pages
+	struct SceneMemoryReport
+	{
+		struct Storage
+		{
+			std::string Name;
+			size_t Count = 0;
+			size_t Bytes = 0;
+		};
+
+		Array<Storage> Storages;
+		size_t EntityCount = 0;
+		// Every storage plus the registry's own entity list
+		size_t TotalBytes = 0;
+	};
 	
 	class Scene {
 	public:
@@ -24,9 +47,13 @@ namespace Nebula {
 
 		Entity CreateEntity(std::string_view name);
 		Entity CreateEntity(UUID uuid, std::string_view name);
+		// While playing or simulating this only queues the entity, it is destroyed with its children at the next sync point
 		void DestroyEntity(Entity entity);
 
 		Entity DuplicateEntity(Entity entity, bool duplicateIntoParent = true);
+		// Copies the components of source, which may belong to another scene, onto a new root entity.
+		// Children, script instances and physics bodies are left to the caller
+		Entity CopyEntity(Entity source);
 		
 		void OnRuntimeStart();
 		void OnRuntimeStop();
@@ -41,6 +68,7 @@ namespace Nebula {
 		void RenderRuntime();
 		void RenderRuntimeOverlay();
 
+		// The overlays draw the text gathered by the Render call before them
 		void Render(EditorCamera& camera);
 		void RenderOverlay(EditorCamera& camera);
 
@@ -51,8 +79,18 @@ namespace Nebula {
 
 		Entity GetPrimaryCamera();
 		Entity GetEntityWithTag(std::string_view tag);
+		// Searches the direct children of parent, or the root entities if parent is null
+		Entity GetChildWithTag(Entity parent, std::string_view tag);
 		Entity GetEntityWithUUID(UUID id);
 
+		// Returns the closest enabled renderable under ndc, without touching the gpu
+		Entity PickEntity(const glm::mat4& viewProjection, const glm::vec2& ndc);
+
+		// Spawned through PrefabSerializer::Spawn, all zero for prefabs that were never spawned
+		PrefabPoolStats GetPrefabPoolStats(const std::string& filepath) const { return m_PrefabPool.GetStats(filepath); }
+		// Walks every storage, meant for debug windows rather than every frame
+		SceneMemoryReport GetMemoryReport();
+
 		template <typename... Components>
 		auto GetAllEntitiesWith() {
 			return m_Registry.view<Components...>();
@@ -62,9 +100,41 @@ namespace Nebula {
 		bool IsPaused() const { return m_IsPaused; }
 		bool IsRunning() const { return m_IsRunning; }
 
+		// Scene wide change counter, keep it after a query to only see later changes
+		uint64_t GetChangeVersion() const { return m_ChangeTracker.GetVersion(); }
+		// The version of the last change to any T
+		template<typename T>
+		uint64_t GetComponentVersion() const { return m_ChangeTracker.GetStorageVersion<T>(); }
+		// Calls func(entt::entity, T&) for every T that changed after since, T must be in TrackedComponents
+		template<typename T, typename Func>
+		void EachChanged(uint64_t since, Func func) { m_ChangeTracker.EachChanged<T>(m_Registry, since, func); }
+
+		// Runs with the engine's systems during UpdateRuntime. Systems on workers must not create or destroy entities
+		void AddSystem(const std::string& name, SystemStage stage, const SystemAccess& access, const SceneSystemScheduler::SystemFunction& function) { m_Systems.Add(name, stage, access, function); }
+		void RemoveSystem(const std::string& name) { m_Systems.Remove(name); }
+		// Per system timings of the last runtime frame
+		const SystemTimeline& GetSystemTimeline() const { return m_Systems.GetTimeline(); }
+		// What RenderRuntime draws, extracted at the end of the last UpdateRuntime
+		const RenderPacketBuffer& GetRenderPackets() const { return m_RenderPackets[m_ExtractIndex ^ 1]; }
+
+		// Unique per scene instance, lets scripts cache entity handles without mixing up scenes
+		uint32_t GetEpoch() const { return m_Epoch; }
+
 		void Step(int frames = 1);
 
-		Array<UUID> m_SceneOrder;
+		// for (Entity root = scene->GetFirstRoot(); root; root = root.GetNextSibling())
+		Entity GetFirstRoot();
+		uint32_t GetRootCount() const { return m_RootLinks.ChildCount; }
+
+		// Makes entity the last child of parent, or a root entity if parent is null
+		void SetParent(Entity entity, Entity parent);
+		// Reorders entity within its parent, directly after sibling or first if sibling is null
+		void MoveAfter(Entity entity, Entity sibling);
+
+		// Recalculates the world transform of every dirty entity and its children, parents first
+		void UpdateTransforms();
+		// Call after changing parents or children outside of the scene
+		void MarkHierarchyDirty() { m_TransformHierarchyOutdated = true; }
 	private:
 		void CreateBox2DBody(Entity entity);
 		void UpdateBox2DBody(Entity entity);
@@ -73,15 +143,75 @@ namespace Nebula {
 		void UpdatePhysics();
 		void DestroyPhysics();
 
+		// Destroys everything queued by DestroyEntity, along with their children
+		void FlushDestroyQueue();
+
 		void InitScripts();
 		void UpdateScripts();
+		void UpdateNativeScripts();
 		void DestroyScripts();
 
+		void AddEngineSystems();
+		void FindPrimaryCamera();
+		void ExtractRenderPackets();
+		void FillRenderPackets(RenderPacketBuffer& packets);
+		void DrawRenderPackets(const RenderPacketBuffer& packets);
+
+		// Owning groups keep these pools packed and co-indexed for the render and physics loops.
+		// A component can only be owned by one group, every other query has to use them as they are or a view
+		auto GetSpriteGroup() { return m_Registry.group<WorldTransformComponent, SpriteRendererComponent>(entt::exclude<DisabledTag>); }
+		auto GetCircleGroup() { return m_Registry.group<CircleRendererComponent>(entt::get<WorldTransformComponent>, entt::exclude<DisabledTag>); }
+		auto GetStringGroup() { return m_Registry.group<StringRendererComponent>(entt::get<WorldTransformComponent>, entt::exclude<DisabledTag>); }
+		auto GetBodyGroup() { return m_Registry.group<Rigidbody2DComponent>(entt::get<TransformComponent>); }
+
+		// A null parent means the root list
+		ParentChildComponent& GetLinks(entt::entity parent);
+		void AttachChild(entt::entity parent, entt::entity child, entt::entity after);
+		void DetachChild(entt::entity child);
+
+		void RebuildTransformHierarchy();
+		// Returns true if the world transform had to be recalculated
+		bool ResolveTransform(entt::entity entity);
+
+		void OnTagConstruct(entt::registry& registry, entt::entity entity);
+		void OnTagUpdate(entt::registry& registry, entt::entity entity);
+		void OnTagDestroy(entt::registry& registry, entt::entity entity);
+
+		void OnPooledDestroy(entt::registry& registry, entt::entity entity);
+
+		template<typename... Component>
+		void ConnectChangeSignals(ComponentGroup<Component...>);
+		template<typename... Component>
+		void DisconnectChangeSignals(ComponentGroup<Component...>);
+		template<typename... Component>
+		void PrepareStorages(ComponentGroup<Component...>);
+		template<typename T>
+		void AddStorageReport(SceneMemoryReport& report, const char* name);
+		template<typename... Component>
+		size_t GetStorageBytes(ComponentGroup<Component...>);
+		template<typename T>
+		void OnComponentChanged(entt::registry& registry, entt::entity entity) { m_ChangeTracker.MarkChanged<T>(registry, entity); }
+
 		template<typename T>
 		void OnComponentAdded(Entity entity, T& component);
 	private:
 		entt::registry m_Registry;
-		std::unordered_map<UUID, entt::entity> m_EntityMap;
+		uint32_t m_Epoch = 0;
+		FlatHashMap<UUID, entt::entity> m_EntityMap;
+
+		// Root entities are siblings of each other, in hierarchy order
+		ParentChildComponent m_RootLinks;
+
+		// Kept up to date through the TagComponent signals and AttachChild/DetachChild
+		SceneTagIndex m_TagIndex;
+
+		// Despawned prefab instances, kept until they are spawned again or the scene is destroyed
+		ScenePrefabPool m_PrefabPool;
+
+		// Stamped through the component signals and Entity::GetComponent
+		SceneChangeTracker m_ChangeTracker;
+
+		SceneSystemScheduler m_Systems;
 
 		bool m_IsRunning = false, m_IsPaused = false;
 		int m_StepFrames = 0;
@@ -91,9 +221,35 @@ namespace Nebula {
 		b2World* m_PhysicsWorld = nullptr;
 		ContactListener* m_ContactListener = nullptr;
 
+		// The set keeps every entity in the queue once
+		Array<entt::entity> m_DestroyQueue;
+		std::unordered_set<entt::entity> m_DestroyQueued;
+
+		ScenePicker m_Picker;
+		bool m_PickerOutdated = true;
+		uint64_t m_PickerVersion = 0;
+
+		// Every entity ordered by depth, so parents are always updated before their children
+		struct TransformNode
+		{
+			entt::entity Handle;
+			uint32_t Parent;
+			bool Updated = false;
+		};
+		Array<TransformNode> m_TransformHierarchy;
+		// Where each depth starts in m_TransformHierarchy, plus the end. Nodes of one depth are updated in parallel
+		Array<uint32_t> m_TransformDepths;
+		bool m_TransformHierarchyOutdated = true;
+
 		Camera* mainCam = nullptr;
 		glm::mat4 mainCamTransform;
 
+		// Extraction fills one buffer while rendering reads the other
+		RenderPacketBuffer m_RenderPackets[2];
+		uint32_t m_ExtractIndex = 0;
+		// Refilled by every editor Render call
+		RenderPacketBuffer m_EditorPackets;
+
 		friend class Entity;
 		friend class SceneHierarchyPanel;
 		friend class SceneSerializer;
@@ -0,0 +1,15 @@
+#include "nbpch.h"
+#include "Scene_ChangeTracker.h"
+
+namespace Nebula {
+	void SceneChangeTracker::NextFrame() {
+		for (auto& [type, log] : m_Logs) {
+			log.Previous.swap(log.Current);
+			log.Current.clear();
+
+			log.PreviousStart = log.CurrentStart;
+			log.CurrentStart = m_Version;
+			log.Generation++;
+		}
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "entt.hpp"
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Core/JobSystem.h"
+#include "Nebula/Utils/Arrays.h"
+
+#include <unordered_map>
+
+namespace Nebula {
+	// When an entity's T last changed, stored in the registry next to T
+	template<typename T>
+	struct ComponentVersion {
+		uint64_t Version = 0;
+		uint32_t LoggedGeneration = UINT32_MAX;
+	};
+
+	// Every change takes the next value of a scene wide counter, which is stamped on the entity and the storage.
+	// Changes are also logged per type for the current and previous frame, so a system that ran
+	// during the last frame only visits what changed since. Older queries scan the storage instead.
+	//
+	// uint64_t lastRun = 0;
+	// scene->EachChanged<SpriteRendererComponent>(lastRun, [](entt::entity entity, SpriteRendererComponent& sprite) { ... });
+	// lastRun = scene->GetChangeVersion();
+	//
+	// Changes are only marked from the main thread. Systems on workers read through the registry and leave marking to the main thread.
+	class SceneChangeTracker {
+	public:
+		SceneChangeTracker() = default;
+
+		uint64_t GetVersion() const { return m_Version; }
+
+		// Creates T's log, every tracked type is registered before the scene is used
+		template<typename T>
+		void Register() {
+			m_Logs[entt::type_info<T>::id()];
+		}
+
+		template<typename T>
+		void MarkChanged(entt::registry& registry, entt::entity entity) {
+			NB_ASSERT(JobSystem::GetThreadIndex() == 0, "[SceneChangeTracker] Changes are marked from the main thread");
+
+			auto it = m_Logs.find(entt::type_info<T>::id());
+			NB_ASSERT(it != m_Logs.end(), "[SceneChangeTracker] Component type was never registered");
+
+			ChangeLog& log = it->second;
+			log.Version = ++m_Version;
+
+			auto& stamp = registry.get_or_emplace<ComponentVersion<T>>(entity);
+			stamp.Version = m_Version;
+
+			if (stamp.LoggedGeneration != log.Generation) {
+				stamp.LoggedGeneration = log.Generation;
+				log.Current.push_back(entity);
+			}
+		}
+
+		// The version of the last change to any T, 0 if none has changed
+		template<typename T>
+		uint64_t GetStorageVersion() const {
+			auto it = m_Logs.find(entt::type_info<T>::id());
+			return it != m_Logs.end() ? it->second.Version : 0;
+		}
+
+		template<typename T>
+		uint64_t GetEntityVersion(const entt::registry& registry, entt::entity entity) const {
+			const auto* stamp = registry.try_get<ComponentVersion<T>>(entity);
+			return stamp ? stamp->Version : 0;
+		}
+
+		// Calls func(entity, component) for every T that changed after since
+		template<typename T, typename Func>
+		void EachChanged(entt::registry& registry, uint64_t since, Func func) {
+			auto it = m_Logs.find(entt::type_info<T>::id());
+			if (it == m_Logs.end() || it->second.Version <= since)
+				return;
+
+			const ChangeLog& log = it->second;
+			if (since < log.PreviousStart) {
+				auto view = registry.view<T, ComponentVersion<T>>();
+				for (auto entity : view) {
+					if (view.template get<ComponentVersion<T>>(entity).Version > since)
+						func(entity, view.template get<T>(entity));
+				}
+
+				return;
+			}
+
+			// Entities changed again this frame are only visited from the current log.
+			// Both logs are walked by index, func may change more components
+			for (size_t i = 0, count = log.Previous.size(); i < count; i++) {
+				entt::entity entity = log.Previous[i];
+				if (!registry.valid(entity) || !registry.has<T>(entity))
+					continue;
+
+				const auto& stamp = registry.get<ComponentVersion<T>>(entity);
+				if (stamp.Version > since && stamp.LoggedGeneration != log.Generation)
+					func(entity, registry.get<T>(entity));
+			}
+
+			for (size_t i = 0, count = log.Current.size(); i < count; i++) {
+				entt::entity entity = log.Current[i];
+				if (!registry.valid(entity) || !registry.has<T>(entity))
+					continue;
+
+				if (registry.get<ComponentVersion<T>>(entity).Version > since)
+					func(entity, registry.get<T>(entity));
+			}
+		}
+
+		// Called once per frame, before any system runs
+		void NextFrame();
+	private:
+		struct ChangeLog {
+			uint64_t Version = 0;
+			uint32_t Generation = 0;
+
+			// Every change after PreviousStart is in one of the logs
+			uint64_t PreviousStart = 0, CurrentStart = 0;
+			Array<entt::entity> Previous, Current;
+		};
+	private:
+		uint64_t m_Version = 0;
+		std::unordered_map<entt::id_type, ChangeLog> m_Logs;
+	};
+}
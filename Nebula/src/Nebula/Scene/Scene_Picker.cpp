@@ -0,0 +1,138 @@
+#include "nbpch.h"
+#include "Scene_Picker.h"
+
+#include "Components.h"
+
+namespace Nebula {
+	void ScenePicker::ScreenToRay(const glm::mat4& viewProjection, const glm::vec2& ndc, glm::vec3& outOrigin, glm::vec3& outDirection) {
+		glm::mat4 inverse = glm::inverse(viewProjection);
+
+		glm::vec4 nearPoint = inverse * glm::vec4(ndc, -1.0f, 1.0f);
+		glm::vec4 farPoint = inverse * glm::vec4(ndc, 1.0f, 1.0f);
+
+		outOrigin = glm::vec3(nearPoint) / nearPoint.w;
+		outDirection = glm::vec3(farPoint) / farPoint.w - outOrigin;
+	}
+
+	void ScenePicker::Rebuild(entt::registry& registry) {
+		NB_PROFILE_FUNCTION();
+
+		m_Pickables.clear();
+
+		// Same order as Scene::Render, so ties resolve like the depth test (GL_LESS keeps the first draw)
+		auto sprites = registry.view<WorldTransformComponent, SpriteRendererComponent>(entt::exclude<DisabledTag>);
+		for (auto entity : sprites) {
+			AddPickable(entity, Shape::Quad, sprites.get<WorldTransformComponent>(entity).Transform.ToMat4(), { -0.5f, -0.5f, 0.5f, 0.5f });
+		}
+
+		auto circles = registry.view<WorldTransformComponent, CircleRendererComponent>(entt::exclude<DisabledTag>);
+		for (auto entity : circles) {
+			float thickness = glm::clamp(circles.get<CircleRendererComponent>(entity).Thickness, 0.0f, 1.0f);
+			AddPickable(entity, Shape::Circle, circles.get<WorldTransformComponent>(entity).Transform.ToMat4(), { -0.5f, -0.5f, 0.5f, 0.5f }, 0.5f * (1.0f - thickness));
+		}
+
+		auto strings = registry.view<WorldTransformComponent, StringRendererComponent>(entt::exclude<DisabledTag>);
+		for (auto entity : strings) {
+			auto& src = strings.get<StringRendererComponent>(entity);
+			Ref<Font> font = src.GetFont();
+			if (src.Text.empty() || !font)
+				continue;
+
+			glm::vec4 bounds = font->GetStringBounds(src.Text, src.Kerning, src.LineSpacing);
+			AddPickable(entity, Shape::Text, strings.get<WorldTransformComponent>(entity).Transform.ToMat4(), bounds);
+		}
+	}
+
+	void ScenePicker::AddPickable(entt::entity handle, Shape type, const glm::mat4& transform, const glm::vec4& localBounds, float innerRadius) {
+		Pickable& pickable = m_Pickables.emplace_back();
+		pickable.Handle = handle;
+		pickable.Type = type;
+		pickable.LocalBounds = localBounds;
+		pickable.InnerRadius = innerRadius;
+		pickable.InverseTransform = glm::inverse(transform);
+
+		const glm::vec4 corners[4] = {
+			{ localBounds.x, localBounds.y, 0.0f, 1.0f },
+			{ localBounds.z, localBounds.y, 0.0f, 1.0f },
+			{ localBounds.z, localBounds.w, 0.0f, 1.0f },
+			{ localBounds.x, localBounds.w, 0.0f, 1.0f }
+		};
+
+		pickable.Min = glm::vec3(FLT_MAX);
+		pickable.Max = glm::vec3(-FLT_MAX);
+		for (const glm::vec4& corner : corners) {
+			glm::vec3 point = transform * corner;
+			pickable.Min = glm::min(pickable.Min, point);
+			pickable.Max = glm::max(pickable.Max, point);
+		}
+	}
+
+	bool ScenePicker::HitTest(const Pickable& pickable, const glm::vec3& origin, const glm::vec3& direction, float& outDistance) const {
+		// Broad phase: slab test against the cached world AABB
+		float tMin = -FLT_MAX, tMax = FLT_MAX;
+		for (int axis = 0; axis < 3; axis++) {
+			if (glm::abs(direction[axis]) < Maths::epsilon()) {
+				if (origin[axis] < pickable.Min[axis] - Maths::epsilon() || origin[axis] > pickable.Max[axis] + Maths::epsilon())
+					return false;
+
+				continue;
+			}
+
+			float t0 = (pickable.Min[axis] - origin[axis]) / direction[axis];
+			float t1 = (pickable.Max[axis] - origin[axis]) / direction[axis];
+			tMin = glm::max(tMin, glm::min(t0, t1));
+			tMax = glm::min(tMax, glm::max(t0, t1));
+		}
+
+		if (tMax < tMin || tMax < 0.0f)
+			return false;
+
+		// Narrow phase: intersect with the shape's local z = 0 plane
+		glm::vec3 localOrigin = pickable.InverseTransform * glm::vec4(origin, 1.0f);
+		glm::vec3 localDirection = pickable.InverseTransform * glm::vec4(direction, 0.0f);
+
+		if (glm::abs(localDirection.z) < Maths::epsilon())
+			return false;
+
+		float t = -localOrigin.z / localDirection.z;
+		if (t < 0.0f)
+			return false;
+
+		glm::vec2 point = localOrigin + localDirection * t;
+		const glm::vec4& bounds = pickable.LocalBounds;
+		if (point.x < bounds.x || point.y < bounds.y || point.x > bounds.z || point.y > bounds.w)
+			return false;
+
+		if (pickable.Type == Shape::Circle) {
+			float distance = glm::length(point);
+			if (distance > 0.5f || distance < pickable.InnerRadius)
+				return false;
+		}
+
+		outDistance = t;
+		return true;
+	}
+
+	entt::entity ScenePicker::Pick(const glm::vec3& origin, const glm::vec3& direction) const {
+		NB_PROFILE_FUNCTION();
+
+		entt::entity closest = entt::null;
+		float closestDistance = FLT_MAX;
+
+		for (const Pickable& pickable : m_Pickables) {
+			float distance;
+			if (HitTest(pickable, origin, direction, distance) && distance < closestDistance) {
+				closest = pickable.Handle;
+				closestDistance = distance;
+			}
+		}
+
+		return closest;
+	}
+
+	entt::entity ScenePicker::Pick(const glm::mat4& viewProjection, const glm::vec2& ndc) const {
+		glm::vec3 origin, direction;
+		ScreenToRay(viewProjection, ndc, origin, direction);
+		return Pick(origin, direction);
+	}
+}
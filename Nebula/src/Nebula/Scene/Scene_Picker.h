@@ -0,0 +1,43 @@
+#pragma once
+
+#include "entt.hpp"
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Maths/Maths.h"
+#include "Nebula/Utils/Arrays.h"
+
+namespace Nebula {
+	// CPU side replacement for reading back the entity id attachment.
+	// Caches the world bounds of every renderable and hit-tests rays against them.
+	class ScenePicker {
+	public:
+		ScenePicker() = default;
+
+		void Rebuild(entt::registry& registry);
+		void Clear() { m_Pickables.clear(); }
+
+		entt::entity Pick(const glm::mat4& viewProjection, const glm::vec2& ndc) const;
+		entt::entity Pick(const glm::vec3& origin, const glm::vec3& direction) const;
+
+		static void ScreenToRay(const glm::mat4& viewProjection, const glm::vec2& ndc, glm::vec3& outOrigin, glm::vec3& outDirection);
+	private:
+		enum class Shape : uint8_t { Quad = 0, Circle, Text };
+
+		struct Pickable {
+			entt::entity Handle = entt::null;
+			Shape Type = Shape::Quad;
+
+			glm::mat4 InverseTransform;
+			glm::vec3 Min, Max;
+
+			// Local space rectangle (min x, min y, max x, max y)
+			glm::vec4 LocalBounds = { -0.5f, -0.5f, 0.5f, 0.5f };
+			float InnerRadius = 0.0f;
+		};
+
+		void AddPickable(entt::entity handle, Shape type, const glm::mat4& transform, const glm::vec4& localBounds, float innerRadius = 0.0f);
+		bool HitTest(const Pickable& pickable, const glm::vec3& origin, const glm::vec3& direction, float& outDistance) const;
+	private:
+		Array<Pickable> m_Pickables;
+	};
+}
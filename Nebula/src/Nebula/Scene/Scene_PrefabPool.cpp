@@ -0,0 +1,82 @@
+#include "nbpch.h"
+#include "Scene_PrefabPool.h"
+
+#include "Components.h"
+
+namespace Nebula {
+	uint32_t ScenePrefabPool::GetPool(const std::string& filepath) {
+		auto it = m_Indices.find(filepath);
+		if (it != m_Indices.end())
+			return it->second;
+
+		uint32_t index = (uint32_t)m_Pools.size();
+		m_Indices[filepath] = index;
+
+		Pool& pool = m_Pools.emplace_back();
+		pool.Filepath = filepath;
+		return index;
+	}
+
+	entt::entity ScenePrefabPool::Acquire(entt::registry& registry, uint32_t index) {
+		Pool& pool = m_Pools[index];
+		if (pool.Free.empty()) {
+			pool.Stats.Misses++;
+			return entt::null;
+		}
+
+		entt::entity root = pool.Free.back();
+		pool.Free.pop_back();
+		registry.get<PooledComponent>(root).Slot = UINT32_MAX;
+
+		pool.Stats.Hits++;
+		pool.Stats.Free--;
+		pool.Stats.Active++;
+		return root;
+	}
+
+	void ScenePrefabPool::Track(entt::registry& registry, entt::entity root, uint32_t index) {
+		NB_ASSERT(!registry.has<PooledComponent>(root), "[ScenePrefabPool] Entity already belongs to a pool");
+
+		registry.emplace<PooledComponent>(root, index);
+		m_Pools[index].Stats.Active++;
+	}
+
+	void ScenePrefabPool::Release(entt::registry& registry, entt::entity root) {
+		PooledComponent& pc = registry.get<PooledComponent>(root);
+		NB_ASSERT(pc.Slot == UINT32_MAX, "[ScenePrefabPool] Entity was already released");
+
+		Pool& pool = m_Pools[pc.Pool];
+		pc.Slot = (uint32_t)pool.Free.size();
+		pool.Free.push_back(root);
+
+		pool.Stats.Free++;
+		pool.Stats.Active--;
+	}
+
+	void ScenePrefabPool::Remove(entt::registry& registry, entt::entity root) {
+		PooledComponent& pc = registry.get<PooledComponent>(root);
+		Pool& pool = m_Pools[pc.Pool];
+
+		if (pc.Slot == UINT32_MAX) {
+			pool.Stats.Active--;
+			return;
+		}
+
+		// Swap with the last entry so the other slots stay valid
+		entt::entity last = pool.Free.back();
+		pool.Free[pc.Slot] = last;
+		registry.get<PooledComponent>(last).Slot = pc.Slot;
+
+		pool.Free.pop_back();
+		pc.Slot = UINT32_MAX;
+		pool.Stats.Free--;
+	}
+
+	PrefabPoolStats ScenePrefabPool::GetStats(const std::string& filepath) const {
+		auto it = m_Indices.find(filepath);
+		if (it == m_Indices.end())
+			return {};
+
+		return m_Pools[it->second].Stats;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "entt.hpp"
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Utils/Arrays.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace Nebula {
+	struct PrefabPoolStats {
+		uint32_t Free = 0;
+		uint32_t Active = 0;
+		uint64_t Hits = 0;
+		uint64_t Misses = 0;
+
+		float GetHitRate() const {
+			uint64_t spawns = Hits + Misses;
+			return spawns ? (float)Hits / (float)spawns : 0.0f;
+		}
+	};
+
+	// Despawned prefab instances per prefab file, kept disabled in the scene until they are spawned again.
+	// Instance roots remember their pool and free list slot in PooledComponent, so every operation is O(1).
+	// Only the bookkeeping lives here, PrefabSerializer resets and disables the entities.
+	class ScenePrefabPool {
+	public:
+		ScenePrefabPool() = default;
+
+		// Creates the pool on first use
+		uint32_t GetPool(const std::string& filepath);
+		const std::string& GetFilepath(uint32_t pool) const { return m_Pools[pool].Filepath; }
+
+		// Pops a free root, or returns entt::null on a miss. Either way the spawn is counted
+		entt::entity Acquire(entt::registry& registry, uint32_t pool);
+		// Adds a newly instantiated root to the pool as an active instance
+		void Track(entt::registry& registry, entt::entity root, uint32_t pool);
+		// Moves an active root onto the free list
+		void Release(entt::registry& registry, entt::entity root);
+		// The root is being destroyed, whether it was active or free
+		void Remove(entt::registry& registry, entt::entity root);
+
+		PrefabPoolStats GetStats(const std::string& filepath) const;
+
+		void Clear() { m_Indices.clear(); m_Pools.clear(); }
+	private:
+		struct Pool {
+			std::string Filepath;
+			Array<entt::entity> Free;
+			PrefabPoolStats Stats;
+		};
+	private:
+		std::unordered_map<std::string, uint32_t> m_Indices;
+		Array<Pool> m_Pools;
+	};
+}
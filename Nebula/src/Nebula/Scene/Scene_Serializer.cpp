@@ -12,7 +12,7 @@
 namespace Nebula {
 #define WRITE_SCRIPT_FIELD(FieldType, Type)			\
 	case ScriptFieldType::FieldType: \
-		out << scriptInstance->GetFieldValue<Type>(name); \
+		out << scriptInstance->GetFieldValue<Type>(field.Name); \
 		break
 
 #define READ_SCRIPT_FIELD(FieldType, Type)			\
@@ -33,7 +33,7 @@ namespace Nebula {
 			out << YAML::Key << "TagComponent";
 			out << YAML::BeginMap;
 
-			auto& tag = entity.GetComponent<TagComponent>().Tag;
+			const std::string& tag = entity.GetName();
 			out << YAML::Key << "Tag" << YAML::Value << tag;
 
 			out << YAML::EndMap;
@@ -45,7 +45,7 @@ namespace Nebula {
 
 			auto& component = entity.GetComponent<PropertiesComponent>();
 			out << YAML::Key << "IsEnabled" << YAML::Value << component.Enabled;
-			out << YAML::Key << "Layer" << YAML::Value << component.Layer->Identity;
+			out << YAML::Key << "Layer" << YAML::Value << component.Layer;
 
 			out << YAML::EndMap; // TransformComponent
 		}
@@ -55,15 +55,16 @@ namespace Nebula {
 			out << YAML::BeginMap; // ParentChildComponent
 
 			auto& component = entity.GetComponent<ParentChildComponent>();
+			Entity parent = entity.GetParent();
 
 			YAML::Node children;
-			for (uint32_t i = 0; i < component.ChildrenIDs.size(); i++)
-				children.push_back((uint64_t)component[i]);
+			for (Entity child = entity.GetFirstChild(); child; child = child.GetNextSibling())
+				children.push_back((uint64_t)child.GetUUID());
 			children.SetStyle(YAML::EmitterStyle::Flow);
 			
-			out << YAML::Key << "PrimaryParent" << YAML::Value << component.Parent;
+			out << YAML::Key << "PrimaryParent" << YAML::Value << (parent ? (uint64_t)parent.GetUUID() : 0);
 			out << YAML::Key << "Children" << YAML::Value << children;
-			out << YAML::Key << "ChildCount" << YAML::Value << component.ChildrenIDs.size();
+			out << YAML::Key << "ChildCount" << YAML::Value << component.ChildCount;
 
 			out << YAML::EndMap; // ParentChildComponent
 		}
@@ -153,7 +154,7 @@ namespace Nebula {
 						case ScriptFieldType::Font:
 						case ScriptFieldType::Texture:
 						case ScriptFieldType::Asset:
-							auto data = scriptInstance->GetFieldValue<MonoObject*>(name);
+							auto data = scriptInstance->GetFieldValue<MonoObject*>(field.Name);
 							out << ScriptEngine::GetIDFromObject(data);
 							break;
 						}
@@ -267,13 +268,13 @@ namespace Nebula {
 		out << YAML::Key << "Scene" << YAML::Value << "Untitled";
 		
 		YAML::Node order;
-		for (const UUID& id : m_Scene->m_SceneOrder)
-			order.push_back((uint64_t)id);
+		for (Entity root = m_Scene->GetFirstRoot(); root; root = root.GetNextSibling())
+			order.push_back((uint64_t)root.GetUUID());
 		order.SetStyle(YAML::EmitterStyle::Flow);
 
 		out << YAML::Key << "Order";
 		out << YAML::BeginMap;
-		out << YAML::Key << "Size" << YAML::Value << m_Scene->m_SceneOrder.size();
+		out << YAML::Key << "Size" << YAML::Value << m_Scene->GetRootCount();
 		out << YAML::Key << "Data" << YAML::Value << order;
 		out << YAML::EndMap;
 
@@ -319,6 +320,8 @@ namespace Nebula {
 		if (!entities)
 			return true;
 
+		Array<std::pair<Entity, YAML::Node>> hierarchy;
+
 		for (auto entity : entities) {
 			uint64_t uuid = entity["Entity"].as<uint64_t>();
 
@@ -333,23 +336,15 @@ namespace Nebula {
 
 			if (auto propComponent = entity["PropertiesComponent"]) {
 				auto& prop = deserializedEntity.GetComponent<PropertiesComponent>();
-				DeserializeValue(prop.Enabled, propComponent["IsEnabled"]);
+				deserializedEntity.SetEnabled(DeserializeValue(propComponent["IsEnabled"], true));
 				
 				uint16_t layer = DeserializeValue(propComponent["Layer"], 1);
-				prop.Layer = Project::GetActive()->GetConfig().Layers[layer];
+				prop.Layer = layer;
 			}
 
 			if (auto parentComponent = entity["ParentChildComponent"]) {
-				auto& pcc = deserializedEntity.GetComponent<ParentChildComponent>();
-
-				DeserializeValue(pcc.Parent, parentComponent["PrimaryParent"]);
-				if (pcc.Parent)
-					m_Scene->m_SceneOrder.remove(uuid);
-
-				uint32_t count = DeserializeValue<uint32_t>(parentComponent["ChildCount"]);
-				auto children = parentComponent["Children"];
-				for (uint32_t i = 0; i < count; i++)
-					pcc.AddChild(children[i].as<uint64_t>());
+				if (auto children = parentComponent["Children"])
+					hierarchy.push_back({ deserializedEntity, children });
 			}
 
 			if (auto transformComponent = entity["TransformComponent"]) {
@@ -505,18 +500,35 @@ namespace Nebula {
 			}
 		}
 
+		// Children can be deserialized before their parents
+		for (auto& [parent, children] : hierarchy)
+		{
+			for (auto child : children)
+			{
+				if (Entity childEntity = { UUID(child.as<uint64_t>()), m_Scene.get() })
+					m_Scene->SetParent(childEntity, parent);
+			}
+		}
+
 		if (auto order = data["Order"])
 		{
 			uint32_t count = order["Size"].as<uint32_t>();
 			auto scene_order = order["Data"];
 
-			m_Scene->m_SceneOrder.clear();
+			Entity previous = {};
 			for (uint32_t i = 0; i < count; i++)
-				m_Scene->m_SceneOrder.push_back(scene_order[i].as<uint64_t>());
+			{
+				Entity root = { UUID(scene_order[i].as<uint64_t>()), m_Scene.get() };
+				if (!root || root.GetParent())
+					continue;
+
+				m_Scene->MoveAfter(root, previous);
+				previous = root;
+			}
 		}
 
-		for (auto entity : m_Scene->GetAllEntitiesWith<TransformComponent>())
-			Entity{ entity, m_Scene.get() }.CalculateTransform();
+		m_Scene->MarkHierarchyDirty();
+		m_Scene->UpdateTransforms();
 		
 		return true;
 	}
@@ -0,0 +1,206 @@
+#include "nbpch.h"
+#include "Scene_Systems.h"
+
+#include "Nebula/Core/JobSystem.h"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace Nebula {
+	namespace Utils {
+		static bool Overlaps(const Array<entt::id_type>& a, const Array<entt::id_type>& b) {
+			for (entt::id_type id : a)
+			{
+				if (std::find(b.begin(), b.end(), id) != b.end())
+					return true;
+			}
+
+			return false;
+		}
+
+		static float ToMilliseconds(std::chrono::steady_clock::duration duration) {
+			return std::chrono::duration<float, std::milli>(duration).count();
+		}
+	}
+
+	bool SystemAccess::ConflictsWith(const SystemAccess& other) const {
+		if (Exclusive || other.Exclusive)
+			return true;
+
+		return Utils::Overlaps(Writes, other.Writes) || Utils::Overlaps(Writes, other.Reads) || Utils::Overlaps(Reads, other.Writes);
+	}
+
+	void SceneSystemScheduler::Add(const std::string& name, SystemStage stage, const SystemAccess& access, const SystemFunction& function) {
+		NB_ASSERT(function, "[SceneSystemScheduler] System has no function");
+
+		// After the last system of the same stage
+		auto it = std::find_if(m_Systems.begin(), m_Systems.end(), [stage](const System& system) { return system.Stage > stage; });
+
+		System system;
+		system.Name = name;
+		system.Stage = stage;
+		system.Access = access;
+		system.Function = function;
+
+		m_Systems.insert(it, system);
+		m_GraphOutdated = true;
+	}
+
+	void SceneSystemScheduler::Remove(const std::string& name) {
+		auto it = std::find_if(m_Systems.begin(), m_Systems.end(), [&name](const System& system) { return system.Name == name; });
+		if (it == m_Systems.end())
+			return;
+
+		m_Systems.erase(it);
+		m_GraphOutdated = true;
+	}
+
+	void SceneSystemScheduler::BuildGraph() {
+		for (System& system : m_Systems)
+		{
+			system.Dependents.clear();
+			system.DependencyCount = 0;
+		}
+
+		// Every conflicting pair runs in list order, which is stage order first
+		for (uint32_t i = 0; i < m_Systems.size(); i++)
+		{
+			for (uint32_t j = i + 1; j < m_Systems.size(); j++)
+			{
+				if (!m_Systems[i].Access.ConflictsWith(m_Systems[j].Access))
+					continue;
+
+				m_Systems[i].Dependents.push_back(j);
+				m_Systems[j].DependencyCount++;
+			}
+		}
+
+		m_GraphOutdated = false;
+	}
+
+	void SceneSystemScheduler::Execute(Scene& scene, uint32_t index, std::chrono::steady_clock::time_point frameStart) {
+		auto start = std::chrono::steady_clock::now();
+		m_Systems[index].Function(scene);
+		auto end = std::chrono::steady_clock::now();
+
+		SystemTiming& timing = m_Timeline.Systems[index];
+		timing.Name = m_Systems[index].Name;
+		timing.Start = Utils::ToMilliseconds(start - frameStart);
+		timing.Duration = Utils::ToMilliseconds(end - start);
+		timing.Thread = JobSystem::GetThreadIndex();
+	}
+
+	void SceneSystemScheduler::Run(Scene& scene) {
+		NB_PROFILE_FUNCTION();
+
+		if (m_GraphOutdated)
+			BuildGraph();
+
+		uint32_t systemCount = (uint32_t)m_Systems.size();
+		uint32_t threadCount = JobSystem::GetWorkerCount() + 1;
+		bool hasWorkers = threadCount > 1;
+
+		m_Timeline.Systems.resize(systemCount);
+
+		Array<uint64_t> busyTime(threadCount);
+		for (uint32_t thread = 0; thread < threadCount; thread++)
+			busyTime[thread] = JobSystem::GetBusyTime(thread);
+
+		Array<uint32_t> remaining(systemCount);
+		for (uint32_t i = 0; i < systemCount; i++)
+			remaining[i] = m_Systems[i].DependencyCount;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		JobCounter counter;
+
+		Array<uint32_t> mainQueue;
+		uint32_t finished = 0;
+
+		auto frameStart = std::chrono::steady_clock::now();
+
+		// Both are called with the mutex held
+		std::function<void(uint32_t)> schedule;
+		auto complete = [&](uint32_t index) {
+			for (uint32_t dependent : m_Systems[index].Dependents)
+			{
+				if (--remaining[dependent] == 0)
+					schedule(dependent);
+			}
+
+			finished++;
+			condition.notify_all();
+		};
+
+		schedule = [&](uint32_t index) {
+			if (!hasWorkers || m_Systems[index].Access.MainThread)
+			{
+				mainQueue.push_back(index);
+				return;
+			}
+
+			JobSystem::Submit(m_Systems[index].Name, [&, index]() {
+				Execute(scene, index, frameStart);
+
+				std::scoped_lock lock(mutex);
+				complete(index);
+			}, &counter);
+		};
+
+		// Jobs the main thread runs inside its own systems are already part of their time
+		std::chrono::steady_clock::duration mainSystemTime = {};
+		uint64_t nestedBusyTime = 0;
+
+		std::unique_lock lock(mutex);
+		for (uint32_t i = 0; i < systemCount; i++)
+		{
+			if (remaining[i] == 0)
+				schedule(i);
+		}
+
+		while (finished < systemCount)
+		{
+			if (!mainQueue.empty())
+			{
+				uint32_t index = mainQueue.front();
+				mainQueue.erase(mainQueue.begin());
+				lock.unlock();
+
+				uint64_t busyBefore = JobSystem::GetBusyTime(0);
+				auto start = std::chrono::steady_clock::now();
+				Execute(scene, index, frameStart);
+				mainSystemTime += std::chrono::steady_clock::now() - start;
+				nestedBusyTime += JobSystem::GetBusyTime(0) - busyBefore;
+
+				lock.lock();
+				complete(index);
+				continue;
+			}
+
+			// Help the workers until a system finishes
+			lock.unlock();
+			bool ranJob = JobSystem::RunPendingJob();
+			lock.lock();
+
+			if (!ranJob && mainQueue.empty() && finished < systemCount)
+				condition.wait(lock);
+		}
+		lock.unlock();
+
+		// The last jobs may still be returning
+		JobSystem::Wait(counter);
+
+		float duration = Utils::ToMilliseconds(std::chrono::steady_clock::now() - frameStart);
+		m_Timeline.Duration = duration;
+		m_Timeline.Utilisation.resize(threadCount);
+
+		for (uint32_t thread = 0; thread < threadCount; thread++)
+		{
+			float busy = (JobSystem::GetBusyTime(thread) - busyTime[thread]) / 1e6f;
+			if (thread == 0)
+				busy += Utils::ToMilliseconds(mainSystemTime) - nestedBusyTime / 1e6f;
+
+			m_Timeline.Utilisation[thread] = duration > 0.0f ? std::clamp(busy / duration, 0.0f, 1.0f) : 0.0f;
+		}
+	}
+}
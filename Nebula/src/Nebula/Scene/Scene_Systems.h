@@ -0,0 +1,88 @@
+#pragma once
+
+#include "entt.hpp"
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Utils/Arrays.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+
+namespace Nebula {
+	class Scene;
+
+	// The components a system reads and writes. Two systems conflict if either writes something the other touches,
+	// conflicting systems run in the order they were added and everything else may run at the same time.
+	struct SystemAccess {
+		Array<entt::id_type> Reads, Writes;
+		// For systems that can touch anything or create and destroy entities, like scripts and physics
+		bool Exclusive = false;
+		// Mono, Box2D and the renderer have to be used from the main thread
+		bool MainThread = false;
+
+		template<typename... Component>
+		SystemAccess& Read() { (Reads.push_back(entt::type_info<Component>::id()), ...); return *this; }
+		template<typename... Component>
+		SystemAccess& Write() { (Writes.push_back(entt::type_info<Component>::id()), ...); return *this; }
+
+		SystemAccess& All() { Exclusive = true; return *this; }
+		SystemAccess& OnMainThread() { MainThread = true; return *this; }
+
+		bool ConflictsWith(const SystemAccess& other) const;
+	};
+
+	// Systems run in stage order, the order they were added only matters within a stage.
+	// Extract is for copying finished frame data out of the registry
+	enum class SystemStage { Update = 0, Physics, Late, Extract };
+
+	// Milliseconds from the start of the frame
+	struct SystemTiming {
+		std::string Name;
+		float Start = 0.0f, Duration = 0.0f;
+		uint32_t Thread = 0;
+	};
+
+	struct SystemTimeline {
+		Array<SystemTiming> Systems;
+		float Duration = 0.0f;
+		// Time spent running systems and jobs per thread, the main thread first
+		Array<float> Utilisation;
+	};
+
+	// Builds a dependency graph from the declared access and runs each frame's systems on the job system,
+	// keeping main thread systems on the calling thread.
+	class SceneSystemScheduler {
+	public:
+		using SystemFunction = std::function<void(Scene&)>;
+
+		SceneSystemScheduler() = default;
+		SceneSystemScheduler(const SceneSystemScheduler&) = delete;
+
+		void Add(const std::string& name, SystemStage stage, const SystemAccess& access, const SystemFunction& function);
+		void Remove(const std::string& name);
+
+		// Blocks until every system has run
+		void Run(Scene& scene);
+
+		const SystemTimeline& GetTimeline() const { return m_Timeline; }
+	private:
+		void BuildGraph();
+		void Execute(Scene& scene, uint32_t index, std::chrono::steady_clock::time_point frameStart);
+	private:
+		struct System {
+			std::string Name;
+			SystemStage Stage = SystemStage::Update;
+			SystemAccess Access;
+			SystemFunction Function;
+
+			Array<uint32_t> Dependents;
+			uint32_t DependencyCount = 0;
+		};
+
+		Array<System> m_Systems;
+		bool m_GraphOutdated = true;
+
+		SystemTimeline m_Timeline;
+	};
+}
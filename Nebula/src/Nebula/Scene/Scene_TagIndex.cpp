@@ -0,0 +1,73 @@
+#include "nbpch.h"
+#include "Scene_TagIndex.h"
+
+#include "Components.h"
+
+namespace Nebula {
+	static const Array<entt::entity> s_EmptyBucket;
+
+	// Swap with the last entry so the other slots stay valid
+	template<typename Map, typename Key>
+	static void RemoveFromBucket(entt::registry& registry, Map& map, const Key& key, uint32_t TagComponent::* slot, entt::entity entity) {
+		auto it = map.find(key);
+		NB_ASSERT(it != map.end(), "[SceneTagIndex] Entity was never added");
+
+		Array<entt::entity>& bucket = it->second;
+		uint32_t index = registry.get<TagComponent>(entity).*slot;
+
+		entt::entity last = bucket.back();
+		bucket[index] = last;
+		registry.get<TagComponent>(last).*slot = index;
+
+		bucket.pop_back();
+		registry.get<TagComponent>(entity).*slot = UINT32_MAX;
+
+		if (bucket.empty())
+			map.erase(it);
+	}
+
+	void SceneTagIndex::Add(entt::registry& registry, entt::entity entity) {
+		TagComponent& tc = registry.get<TagComponent>(entity);
+		tc.IndexedTag = tc.Tag;
+		tc.ChildSlot = UINT32_MAX;
+
+		Array<entt::entity>& bucket = m_Entities[tc.IndexedTag];
+		tc.TagSlot = (uint32_t)bucket.size();
+		bucket.push_back(entity);
+	}
+
+	void SceneTagIndex::Remove(entt::registry& registry, entt::entity entity) {
+		const TagComponent& tc = registry.get<TagComponent>(entity);
+		if (tc.TagSlot == UINT32_MAX)
+			return;
+
+		RemoveFromBucket(registry, m_Entities, tc.IndexedTag, &TagComponent::TagSlot, entity);
+	}
+
+	void SceneTagIndex::AddChild(entt::registry& registry, entt::entity parent, entt::entity child) {
+		TagComponent& tc = registry.get<TagComponent>(child);
+
+		Array<entt::entity>& bucket = m_Children[{ parent, tc.IndexedTag }];
+		tc.ChildSlot = (uint32_t)bucket.size();
+		tc.IndexedParent = parent;
+		bucket.push_back(child);
+	}
+
+	void SceneTagIndex::RemoveChild(entt::registry& registry, entt::entity child) {
+		const TagComponent& tc = registry.get<TagComponent>(child);
+		if (tc.ChildSlot == UINT32_MAX)
+			return;
+
+		RemoveFromBucket(registry, m_Children, ChildKey{ tc.IndexedParent, tc.IndexedTag }, &TagComponent::ChildSlot, child);
+	}
+
+	const Array<entt::entity>& SceneTagIndex::Find(NameID name) const {
+		auto it = m_Entities.find(name);
+		return it != m_Entities.end() ? it->second : s_EmptyBucket;
+	}
+
+	const Array<entt::entity>& SceneTagIndex::FindChildren(entt::entity parent, NameID name) const {
+		auto it = m_Children.find({ parent, name });
+		return it != m_Children.end() ? it->second : s_EmptyBucket;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "entt.hpp"
+
+#include "Nebula/Core/API.h"
+#include "Nebula/Core/NameID.h"
+#include "Nebula/Utils/Arrays.h"
+
+#include <unordered_map>
+
+namespace Nebula {
+	// Name -> entities, both for the whole scene and per parent.
+	// Entities remember their slot in TagComponent, so adding and removing is O(1).
+	// Tags are interned, so every entity in a bucket has exactly that name.
+	class SceneTagIndex {
+	public:
+		SceneTagIndex() = default;
+
+		// Indexes the current tag
+		void Add(entt::registry& registry, entt::entity entity);
+		// Uses the tag stored at Add, so it works after the tag has changed
+		void Remove(entt::registry& registry, entt::entity entity);
+
+		// A null parent means the root list
+		void AddChild(entt::registry& registry, entt::entity parent, entt::entity child);
+		// Uses the parent stored at AddChild, the links may already be gone
+		void RemoveChild(entt::registry& registry, entt::entity child);
+
+		const Array<entt::entity>& Find(NameID name) const;
+		const Array<entt::entity>& FindChildren(entt::entity parent, NameID name) const;
+
+		void Clear() { m_Entities.clear(); m_Children.clear(); }
+	private:
+		struct ChildKey {
+			entt::entity Parent;
+			NameID Name;
+
+			bool operator==(const ChildKey& other) const { return Parent == other.Parent && Name == other.Name; }
+		};
+
+		struct ChildKeyHasher {
+			size_t operator()(const ChildKey& key) const {
+				return (((uint64_t)key.Name.GetID() << 32) | (uint32_t)key.Parent) * 0x9e3779b97f4a7c15ull;
+			}
+		};
+	private:
+		std::unordered_map<NameID, Array<entt::entity>> m_Entities;
+		std::unordered_map<ChildKey, Array<entt::entity>, ChildKeyHasher> m_Children;
+	};
+}
@@ -18,7 +18,7 @@
 #include "Nebula/Project/Project.h"
 
 namespace Nebula {
-	static std::unordered_map<std::string, ScriptFieldType> s_ScriptFieldTypeMap = {
+	static std::unordered_map<NameID, ScriptFieldType> s_ScriptFieldTypeMap = {
 		{ "System.Single", ScriptFieldType::Float },
 		{ "System.Double", ScriptFieldType::Double },
 		{ "System.Boolean", ScriptFieldType::Bool },
@@ -79,7 +79,10 @@ namespace Nebula {
 
 		ScriptFieldType MonoTypeToScriptFieldType(MonoType* type)
 		{
-			std::string name = mono_type_get_name(type);
+			// Every type in the map is interned, anything else is not a field type
+			NameID name;
+			if (!NameID::Find(mono_type_get_name(type), name))
+				return ScriptFieldType::None;
 
 			auto it = s_ScriptFieldTypeMap.find(name);
 			if (it == s_ScriptFieldTypeMap.end())
@@ -154,8 +157,8 @@ namespace Nebula {
 
 		ScriptClass EntityClass;
 		ScriptClass AssetClass;
-		std::unordered_map<std::string, Ref<ScriptClass>> EntityClasses;
-		std::unordered_map<UUID, Ref<ScriptInstance>> EntityEditorInstances;
+		std::unordered_map<NameID, Ref<ScriptClass>> EntityClasses;
+		ScriptInstanceMap EntityEditorInstances;
 		
 		Scope<filewatch::FileWatch<std::string>> AppAssemblyWatcher;
 		bool AssemblyReloadPending = false;
@@ -167,7 +170,7 @@ namespace Nebula {
 #endif
 		// Runtime
 		Scene* SceneContext = nullptr;
-		std::unordered_map<UUID, Ref<ScriptInstance>> EntityRuntimeInstances;
+		ScriptInstanceMap EntityRuntimeInstances;
 
 		Timer ReloadTimer;
 	};
@@ -519,12 +522,12 @@ namespace Nebula {
 		return s_Data->SceneContext;
 	}
 
-	const std::unordered_map<std::string, Ref<ScriptClass>> ScriptEngine::GetEntityClasses()
+	const std::unordered_map<NameID, Ref<ScriptClass>>& ScriptEngine::GetEntityClasses()
 	{
 		return s_Data->EntityClasses;
 	}
 
-	Ref<ScriptClass> ScriptEngine::GetEntityClass(std::string name)
+	Ref<ScriptClass> ScriptEngine::GetEntityClass(NameID name)
 	{
 		auto it = s_Data->EntityClasses.find(name);
 		if (it == s_Data->EntityClasses.end())
@@ -533,7 +536,7 @@ namespace Nebula {
 		return it->second;
 	}
 	
-	bool ScriptEngine::EntityClassExists(const std::string& signature)
+	bool ScriptEngine::EntityClassExists(NameID signature)
 	{
 		return s_Data->EntityClasses.find(signature) != s_Data->EntityClasses.end();
 	}
@@ -644,7 +647,7 @@ namespace Nebula {
 			if (!isEntity)
 				continue;
 
-			std::string classSig = class_name;
+			NameID classSig = class_name;
 			if (strlen(class_namespace) != 0)
 				classSig = fmt::format("{}.{}", class_namespace, class_name);
 
@@ -666,20 +669,22 @@ namespace Nebula {
 				MonoType* mono_type = mono_field_get_type(field);
 				ScriptFieldType field_type = Utils::MonoTypeToScriptFieldType(mono_type);
 
-				scriptClass->m_Fields[field_name] = { field_type, field_name, field };
+				ScriptField scriptField = { field_type, field_name, field };
+				scriptClass->m_Fields[field_name] = scriptField;
+				scriptClass->m_FieldLookup[scriptField.Name] = scriptField;
 			}
 		}
 	}
 
-	void ScriptEngine::ReloadScripts(std::unordered_map<UUID, Ref<ScriptInstance>>& instances,
+	void ScriptEngine::ReloadScripts(ScriptInstanceMap& instances,
 		fieldMap& field_values, signatureMap& classSig)
 	{
 		Array<UUID> instancesToRemove;
 		for (auto& [entityID, instance] : instances)
 		{
-			if (instances == s_Data->EntityEditorInstances)
+			if (&instances == &s_Data->EntityEditorInstances)
 			{
-				std::string sig = classSig.at(entityID);
+				NameID sig = classSig.at(entityID);
 				if (s_Data->EntityClasses.find(sig) == s_Data->EntityClasses.end())
 				{
 					instancesToRemove.push_back(entityID);
@@ -705,7 +710,7 @@ namespace Nebula {
 			instances.erase(id);
 	}
 
-	void ScriptEngine::GetScriptData(std::unordered_map<UUID, Ref<ScriptInstance>>& instances,
+	void ScriptEngine::GetScriptData(ScriptInstanceMap& instances,
 		fieldMap& field_values, signatureMap& classSig)
 	{
 		for (const auto& [entityID, instance] : instances)
@@ -715,8 +720,7 @@ namespace Nebula {
 			std::string_view name = mono_class_get_name(monoClass);
 			std::string_view nameSpace = mono_class_get_namespace(monoClass);
 
-			std::string sig = fmt::format("{}.{}", nameSpace, name);
-			classSig[entityID] = sig;
+			classSig[entityID] = fmt::format("{}.{}", nameSpace, name);
 
 			const auto& fields = instance->GetScriptClass()->GetFields();
 
@@ -787,6 +791,14 @@ namespace Nebula {
 		m_ScriptClass->InvokeMethod(m_Instance, m_Constructor, &param);
 	}
 
+	void ScriptInstance::ResetOnCreate()
+	{
+		UUID id = m_Entity.GetUUID(); void* param = &id;
+		m_ScriptClass->InvokeMethod(m_Instance, m_Constructor, &param);
+
+		m_OnCreateCalled = false;
+	}
+
 	void ScriptInstance::InvokeOnCreate() 
 	{
 		if (m_OnCreateMethod)
@@ -823,29 +835,29 @@ namespace Nebula {
 		}
 	}
 
-	bool ScriptInstance::GetFieldValueInternal(const std::string& name, void* buffer)
+	const ScriptField* ScriptClass::GetField(NameID name) const
 	{
-		const auto& fields = m_ScriptClass->GetFields();
-		auto it = fields.find(name);
-		if (it == fields.end())
-			return false;
+		auto it = m_FieldLookup.find(name);
+		return it != m_FieldLookup.end() ? &it->second : nullptr;
+	}
 
-		const ScriptField& field = it->second;
+	bool ScriptInstance::GetFieldValueInternal(NameID name, void* buffer)
+	{
+		const ScriptField* field = m_ScriptClass->GetField(name);
+		if (!field)
+			return false;
 
-		mono_field_get_value(m_Instance, field.ClassField, buffer);
+		mono_field_get_value(m_Instance, field->ClassField, buffer);
 		return true;
 	}
 	 
-	 bool ScriptInstance::SetFieldValueInternal(const std::string& name, const void* value)
+	 bool ScriptInstance::SetFieldValueInternal(NameID name, const void* value)
 	 {
-		 const auto& fields = m_ScriptClass->GetFields();
-		 auto it = fields.find(name);
-		 if (it == fields.end())
+		 const ScriptField* field = m_ScriptClass->GetField(name);
+		 if (!field)
 			 return false;
 		 
-		 const ScriptField& field = it->second;
-		 
-		 mono_field_set_value(m_Instance, field.ClassField, (void*)value);
+		 mono_field_set_value(m_Instance, field->ClassField, (void*)value);
 		 return true;
 	 }
 }
\ No newline at end of file
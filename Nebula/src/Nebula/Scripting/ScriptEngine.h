@@ -2,8 +2,10 @@
 
 #include <map>
 
+#include "Nebula/Core/NameID.h"
 #include "Nebula/Scene/Entity.h"
 #include "Nebula/Scene/Scene.h"
+#include "Nebula/Utils/FlatHashMap.h"
 
 extern "C" {
 	typedef struct _MonoClass MonoClass;
@@ -32,7 +34,7 @@ namespace Nebula {
 	struct ScriptField
 	{
 		ScriptFieldType Type;
-		std::string Name;
+		NameID Name;
 		MonoClassField* ClassField;
 	};
 
@@ -47,12 +49,16 @@ namespace Nebula {
 		MonoMethod* GetMethod(const std::string& name, int parameterCount);
 		MonoObject* InvokeMethod(MonoObject* instance, MonoMethod* method, void** parameters = nullptr);
 
-		const std::map<std::string, ScriptField> GetFields() const { return m_Fields; }
+		// Sorted by name, for the editor and serializers
+		const std::map<std::string, ScriptField>& GetFields() const { return m_Fields; }
+		const ScriptField* GetField(NameID name) const;
 	private:
 		std::string m_ClassNamespace;
 		std::string m_ClassName;
 
 		std::map<std::string, ScriptField> m_Fields;
+		// The same fields by interned name, for lookups from the instances
+		std::unordered_map<NameID, ScriptField> m_FieldLookup;
 
 		MonoClass* m_MonoClass = nullptr;
 
@@ -66,6 +72,9 @@ namespace Nebula {
 		ScriptInstance(Ref<ScriptInstance> instance, Entity entity);
 
 		inline bool OnCreateCalled() { return m_OnCreateCalled; }
+		// OnCreate runs again before the next update, used when a pooled entity is spawned again.
+		// The entity constructor runs again too, the old handle belongs to the previous spawn
+		void ResetOnCreate();
 
 		void InvokeOnCreate();
 		void InvokeOnUpdate(float ts);
@@ -76,7 +85,7 @@ namespace Nebula {
 		MonoObject* GetManagedObject() { return m_Instance; }
 	
 		template<typename T>
-		T GetFieldValue(const std::string& name)
+		T GetFieldValue(NameID name)
 		{
 			static_assert(sizeof(T) <= 16, "Type too large");
 			
@@ -88,15 +97,15 @@ namespace Nebula {
 		}
 	
 		template<typename T>
-		void SetFieldValue(const std::string& name, const T& value)
+		void SetFieldValue(NameID name, const T& value)
 		{
 			static_assert(sizeof(T) <= 16, "Type too large");
 			SetFieldValueInternal(name, &value);
 		}
 
-		bool SetFieldValueInternal(const std::string& name, const void* value);
+		bool SetFieldValueInternal(NameID name, const void* value);
 	private:
-		bool GetFieldValueInternal(const std::string& name, void* buffer);
+		bool GetFieldValueInternal(NameID name, void* buffer);
 	private:
 		Ref<ScriptClass> m_ScriptClass;
 
@@ -115,6 +124,8 @@ namespace Nebula {
 		friend class ScriptEngine;
 	};
 
+	using ScriptInstanceMap = FlatHashMap<UUID, Ref<ScriptInstance>>;
+
 	class ScriptEngine {
 	public:
 		static void Init();
@@ -137,9 +148,9 @@ namespace Nebula {
 		static void CopyScriptFields(Entity from, Entity to);
 
 		static Scene* GetSceneContext();
-		static const std::unordered_map<std::string, Ref<ScriptClass>> GetEntityClasses();
-		static Ref<ScriptClass> GetEntityClass(std::string name);
-		static bool EntityClassExists(const std::string& signature);
+		static const std::unordered_map<NameID, Ref<ScriptClass>>& GetEntityClasses();
+		static Ref<ScriptClass> GetEntityClass(NameID name);
+		static bool EntityClassExists(NameID signature);
 
 		static void ClearScriptInstances();
 		static Ref<ScriptInstance> CreateScriptInstance(Entity entity);
@@ -165,12 +176,12 @@ namespace Nebula {
 		friend class ScriptGlue;
 		friend class ScriptInstance;
 	
-		using fieldMap = std::unordered_map<UUID, std::unordered_map<std::string, char*>>;
-		using signatureMap = std::unordered_map<UUID, std::string>;
+		using fieldMap = std::unordered_map<UUID, std::unordered_map<NameID, char*>>;
+		using signatureMap = std::unordered_map<UUID, NameID>;
 
-		static void GetScriptData(std::unordered_map<UUID, Ref<ScriptInstance>>& instances,
+		static void GetScriptData(ScriptInstanceMap& instances,
 			fieldMap& field_values, signatureMap& classSig);
-		static void ReloadScripts(std::unordered_map<UUID, Ref<ScriptInstance>>& instances,
+		static void ReloadScripts(ScriptInstanceMap& instances,
 			fieldMap& field_values, signatureMap& classSig);
 	};
 
@@ -10,7 +10,9 @@
 #include "Nebula/Project/Project.h"
 #include "Nebula/Utils/Time.h"
 #include "Nebula/Utils/Physics2D.h"
+#include "Nebula/Utils/FlatHashMap.h"
 
+#include <mono/metadata/appdomain.h>
 #include <mono/metadata/object.h>
 #include <mono/metadata/reflection.h>
 
@@ -19,10 +21,42 @@
 namespace Nebula {
 
 #define NB_ADD_INTERNAL_CALL(Name) mono_add_internal_call("Nebula.InternalCalls::" #Name, Name);
-	static std::unordered_map<MonoType*, std::function<bool(Entity)>> s_EntityHasComponentFuncs;
-	static std::unordered_map<MonoType*, std::function<void(Entity)>> s_EntityAddComponentFuncs;
+	static FlatHashMap<MonoType*, std::function<bool(Entity)>> s_EntityHasComponentFuncs;
+	static FlatHashMap<MonoType*, std::function<void(Entity)>> s_EntityAddComponentFuncs;
+
+	// Mirrors Nebula.EntityHandle. The native part is a cache, the UUID stays the source of truth
+	struct ScriptEntityHandle
+	{
+		uint64_t ID;
+		uint32_t Native;
+		uint32_t Epoch;
+		uint32_t Generation;
+	};
 
 	namespace Utils {
+		// Entity handles carry their generation, so a destroyed or recycled entity fails IsValid().
+		// A pooled instance keeps its handle and UUID when it is spawned again, so the spawn generation is checked as well
+		static Entity GetEntity(Scene* scene, ScriptEntityHandle* handle)
+		{
+			Entity entity = { (entt::entity)handle->Native, scene };
+			if (handle->Epoch == scene->GetEpoch() && entity.IsValid())
+				return entity.GetComponent<IDComponent>().Generation == handle->Generation ? entity : Entity{};
+
+			bool resolved = handle->Native != UINT32_MAX;
+			entity = { UUID(handle->ID), scene };
+			if (!entity)
+				return entity;
+
+			uint32_t generation = entity.GetComponent<IDComponent>().Generation;
+			if (resolved && generation != handle->Generation)
+				return {};
+
+			handle->Native = (uint32_t)entity;
+			handle->Epoch = scene->GetEpoch();
+			handle->Generation = generation;
+			return entity;
+		}
+
 		static std::string GetStringFromMono(MonoString* text)
 		{
 			char* cStr = mono_string_to_utf8(text);
@@ -214,36 +248,49 @@ namespace Nebula {
 		return entity.GetUUID();
 	}
 
-	static uint64_t Scene_DuplicateEntity(UUID entityID)
+	static uint64_t Scene_DuplicateEntity(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		Entity duplicate = scene->DuplicateEntity(entity);
 		return duplicate.GetUUID();
 	}
 
-	static void Scene_DestroyEntity(UUID entityID)
+	static void Scene_DestroyEntity(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 
 		if (entity)
 		{
 			scene->DestroyEntity(entity);
 		}
 	}
+
+	static void Scene_DespawnEntity(ScriptEntityHandle* handle)
+	{
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		Entity entity = Utils::GetEntity(scene, handle);
+
+		if (entity)
+		{
+			PrefabSerializer serializer(scene);
+			serializer.Despawn(entity);
+		}
+	}
 #pragma endregion
 
 #pragma region Entity
-	static bool Entity_HasComponent(UUID entityID, MonoReflectionType* componentType)
+	static bool Entity_HasComponent(ScriptEntityHandle* handle, MonoReflectionType* componentType)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		MonoType* managedTyped = mono_reflection_type_get_type(componentType);
@@ -252,11 +299,11 @@ namespace Nebula {
 		return s_EntityHasComponentFuncs.at(managedTyped)(entity);
 	}
 
-	static void Entity_AddComponent(UUID entityID, MonoReflectionType* componentType)
+	static void Entity_AddComponent(ScriptEntityHandle* handle, MonoReflectionType* componentType)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		MonoType* managedTyped = mono_reflection_type_get_type(componentType);
@@ -265,38 +312,37 @@ namespace Nebula {
 		s_EntityAddComponentFuncs.at(managedTyped)(entity);
 	}
 
-	static MonoString* Entity_GetName(UUID entityID)
+	static MonoString* Entity_GetName(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		std::string name = entity.GetName();
 		return ScriptEngine::CreateMonoString(name.c_str());
 	}
 
-	static void Entity_SetName(UUID entityID, MonoString* name)
+	static void Entity_SetName(ScriptEntityHandle* handle, MonoString* name)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		auto& component = entity.GetComponent<TagComponent>();
-		component.Tag = Utils::GetStringFromMono(name);
+		entity.SetName(Utils::GetStringFromMono(name));
 	}
 
-	static MonoObject* Entity_GetScriptInstance(UUID entityID)
+	static MonoObject* Entity_GetScriptInstance(ScriptEntityHandle* handle)
 	{
-		return ScriptEngine::GetManagedInstance(entityID);
+		return ScriptEngine::GetManagedInstance(handle->ID);
 	}
 
-	static MonoObject* Entity_SetScriptInstance(UUID entityID, MonoReflectionType* scriptType)
+	static MonoObject* Entity_SetScriptInstance(ScriptEntityHandle* handle, MonoReflectionType* scriptType)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		MonoClass* monoClass = mono_type_get_class(mono_reflection_type_get_type(scriptType));
@@ -312,79 +358,73 @@ namespace Nebula {
 		return instance->GetManagedObject();
 	}
 
-	static uint64_t Entity_FindChildByName(UUID entityID, MonoString* name)
+	static uint64_t Entity_FindChildByName(ScriptEntityHandle* handle, MonoString* name)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		UUID childID = 0;
 		char* cName = mono_string_to_utf8(name);
 
-		const auto& children = entity.GetParentChild().ChildrenIDs;
-		for (const auto& id : children) {
-			Entity ent = { id, scene };
-
-			if (ent.GetName() == cName)
-			{
-				childID = ent.GetUUID();
-				break;
-			}
-		}
-
-		if (childID == 0)
+		if (Entity child = scene->GetChildWithTag(entity, cName))
+			childID = child.GetUUID();
+		else
 			NB_ERROR("Could not find child with name {0}", cName);
 
 		mono_free(cName);
 		return childID;
 	}
 
-	static uint16_t Entity_GetLayer(uint64_t entityID)
+	static uint16_t Entity_GetLayer(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& comp = entity.GetComponent<PropertiesComponent>();
-		return comp.Layer->Identity;
+		return comp.Layer;
 	}
 
-	static void Entity_SetLayer(uint64_t entityID, uint16_t layer)
+	static void Entity_SetLayer(ScriptEntityHandle* handle, uint16_t layer)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& comp = entity.GetComponent<PropertiesComponent>();
-		comp.Layer->Identity = layer;
+		comp.Layer = layer;
+		entity.MarkDirty<PropertiesComponent>();
 	}
 
-	static uint64_t Entity_GetChild(UUID entityID, uint32_t index)
+	static uint64_t Entity_GetChild(ScriptEntityHandle* handle, uint32_t index)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		auto& comp = entity.GetComponent<ParentChildComponent>();
-		if (index > comp.ChildrenIDs.size())
+		if (index >= entity.GetChildCount())
 			return NULL;
 
-		return comp.ChildrenIDs[index];
+		Entity child = entity.GetFirstChild();
+		for (uint32_t i = 0; i < index; i++)
+			child = child.GetNextSibling();
+
+		return child.GetUUID();
 	}
 
-	static uint32_t Entity_GetChildCount(UUID entityID)
+	static uint32_t Entity_GetChildCount(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		auto& comp = entity.GetComponent<ParentChildComponent>();
-		return (uint32_t)comp.ChildrenIDs.size();
+		return entity.GetChildCount();
 	}
 #pragma endregion
 
@@ -407,305 +447,395 @@ namespace Nebula {
 
 		return entity.GetUUID();
 	}
+
+	static MonoArray* Prefab_Instantiate(AssetHandle handle, uint32_t count)
+	{
+		MonoArray* result = mono_array_new(mono_domain_get(), mono_get_uint64_class(), 0);
+		if (!handle || !count)
+			return result;
+
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		const AssetMetadata& metadata = AssetManager::GetAssetMetadata(handle);
+		NB_ASSERT(metadata);
+
+		// The prefab is only parsed once for the whole batch
+		PrefabSerializer serializer(scene);
+		Array<Entity> entities = serializer.Deserialize(metadata.Path.string(), count);
+		
+		result = mono_array_new(mono_domain_get(), mono_get_uint64_class(), entities.size());
+		for (uintptr_t i = 0; i < entities.size(); i++)
+			mono_array_set(result, uint64_t, i, (uint64_t)entities[i].GetUUID());
+
+		return result;
+	}
+
+	static uint64_t Prefab_Spawn(AssetHandle handle)
+	{
+		if (!handle)
+			return NULL;
+
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		const AssetMetadata& metadata = AssetManager::GetAssetMetadata(handle);
+		NB_ASSERT(metadata);
+
+		PrefabSerializer serializer(scene);
+		Entity entity = serializer.Spawn(metadata.Path.string());
+
+		if (!entity)
+			return NULL;
+
+		return entity.GetUUID();
+	}
+
+	static void Prefab_Prewarm(AssetHandle handle, uint32_t count)
+	{
+		if (!handle)
+			return;
+
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		const AssetMetadata& metadata = AssetManager::GetAssetMetadata(handle);
+		NB_ASSERT(metadata);
+
+		PrefabSerializer serializer(scene);
+		serializer.Prewarm(metadata.Path.string(), count);
+	}
+
+	static void Prefab_GetPoolStats(AssetHandle handle, PrefabPoolStats* outStats)
+	{
+		*outStats = {};
+		if (!handle)
+			return;
+
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		const AssetMetadata& metadata = AssetManager::GetAssetMetadata(handle);
+		NB_ASSERT(metadata);
+
+		*outStats = scene->GetPrefabPoolStats(metadata.Path.string());
+	}
 #pragma endregion
 
 #pragma region TransformComponent
-	static void TransformComponent_GetTranslation(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetTranslation(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*out = entity.GetTransform().Translation;
 	}
 
-	static void TransformComponent_SetTranslation(UUID entityID, glm::vec3* translation)
+	static void TransformComponent_SetTranslation(ScriptEntityHandle* handle, glm::vec3* translation)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetTransform().Translation = *translation;
-		entity.UpdateTransform();
+		entity.MarkTransformDirty();
 	}
 
-	static void TransformComponent_GetRotation(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetRotation(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*out = entity.GetTransform().Rotation;
 	}
 
-	static void TransformComponent_SetRotation(UUID entityID, glm::vec3* rotation)
+	static void TransformComponent_SetRotation(ScriptEntityHandle* handle, glm::vec3* rotation)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetTransform().Rotation = *rotation;
-		entity.UpdateTransform();
+		entity.MarkTransformDirty();
 	}
 
-	static void TransformComponent_GetScale(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetScale(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*out = entity.GetTransform().Scale;
 	}
 
-	static void TransformComponent_SetScale(UUID entityID, glm::vec3* scale)
+	static void TransformComponent_SetScale(ScriptEntityHandle* handle, glm::vec3* scale)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetTransform().Scale = *scale;
-		entity.UpdateTransform();
+		entity.MarkTransformDirty();
 	}
 
-	static void TransformComponent_GetWorldTranslation(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetWorldTranslation(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		WorldTransformComponent& world = entity.GetComponent<WorldTransformComponent>();
-		*out = world.Transform[3];
+		WorldTransformComponent& world = entity.GetWorldTransform();
+		*out = world.GetTranslation();
 	}
 
-	static void TransformComponent_GetWorldRotation(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetWorldRotation(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		glm::vec3 translation, scale;
-		WorldTransformComponent& world = entity.GetComponent<WorldTransformComponent>();
-		Maths::DecomposeTransform(world.Transform, translation, *out, scale);
+		WorldTransformComponent& world = entity.GetWorldTransform();
+		*out = { 0.0f, 0.0f, world.Rotation };
 	}
 
-	static void TransformComponent_GetWorldScale(UUID entityID, glm::vec3* out)
+	static void TransformComponent_GetWorldScale(ScriptEntityHandle* handle, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		glm::vec3 translation, rotation;
-		WorldTransformComponent& world = entity.GetComponent<WorldTransformComponent>();
-		Maths::DecomposeTransform(world.Transform, translation, rotation, *out);
+		WorldTransformComponent& world = entity.GetWorldTransform();
+		*out = { world.Scale, 1.0f };
 	}
 #pragma endregion
 
 #pragma region CameraComponent
-	static bool CameraComponent_GetPrimary(UUID entityID) 
+	static bool CameraComponent_GetPrimary(ScriptEntityHandle* handle) 
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CameraComponent>();
 		return component.Primary;
 	}
 
-	static void CameraComponent_SetPrimary(UUID entityID, bool primary)
+	static void CameraComponent_SetPrimary(ScriptEntityHandle* handle, bool primary)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CameraComponent>();
 		component.Primary = primary;
+		entity.MarkDirty<CameraComponent>();
 	}
 
-	static bool CameraComponent_GetFixedRatio(UUID entityID)
+	static bool CameraComponent_GetFixedRatio(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CameraComponent>();
 		return component.FixedAspectRatio;
 	}
 
-	static void CameraComponent_SetFixedRatio(UUID entityID, bool fixedRatio)
+	static void CameraComponent_SetFixedRatio(ScriptEntityHandle* handle, bool fixedRatio)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CameraComponent>();
 		component.FixedAspectRatio = fixedRatio;
+		entity.MarkDirty<CameraComponent>();
 	}
 
-	static void CameraComponent_ScreenToWorld(UUID entityID, glm::vec2 input, glm::vec3* out)
+	static void CameraComponent_ScreenToWorld(ScriptEntityHandle* handle, glm::vec2 input, glm::vec3* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& camComp = entity.GetComponent<CameraComponent>();
 		auto& transform = entity.GetComponent<WorldTransformComponent>();
 
-		float z = transform.Transform[3].z;
+		float z = transform.Transform.Z;
 
 		glm::mat4 iProj = glm::inverse(camComp.Camera.GetProjection());
 		*out = iProj * glm::vec4(input, 0.0f, 1.0f) * z;
-		*out = transform.Transform * glm::vec4(*out, 1.0f);
+		*out = transform.Transform.TransformPoint(*out);
 	}
 
-	static void CameraComponent_WorldToScreen(UUID entityID, glm::vec3 point, glm::vec2* out)
+	static void CameraComponent_WorldToScreen(ScriptEntityHandle* handle, glm::vec3 point, glm::vec2* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& camComp = entity.GetComponent<CameraComponent>();
 		auto& transform = entity.GetComponent<WorldTransformComponent>();
 
-		glm::mat4 iProj = camComp.Camera.GetProjection() * glm::inverse(transform.Transform);
+		glm::mat4 iProj = camComp.Camera.GetProjection() * glm::inverse(transform.Transform.ToMat4());
 		*out = iProj * glm::vec4(point, 1.0f);
 	}
+
+	static uint64_t CameraComponent_PickEntity(ScriptEntityHandle* handle, glm::vec2 input)
+	{
+		Scene* scene = ScriptEngine::GetSceneContext();
+		NB_ASSERT(scene);
+		Entity entity = Utils::GetEntity(scene, handle);
+		NB_ASSERT(entity);
+
+		auto& camComp = entity.GetComponent<CameraComponent>();
+		auto& transform = entity.GetComponent<WorldTransformComponent>();
+
+		glm::mat4 viewProjection = camComp.Camera.GetProjection() * glm::inverse(transform.Transform.ToMat4());
+		Entity picked = scene->PickEntity(viewProjection, input);
+		return picked ? (uint64_t)picked.GetUUID() : 0;
+	}
 #pragma endregion
 
 #pragma region ScriptComponent
-	static MonoString* ScriptComponent_GetClass(UUID entityID)
+	static MonoString* ScriptComponent_GetClass(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
-		std::string name = entity.GetComponent<ScriptComponent>().ClassName;
+		const std::string& name = entity.GetComponent<ScriptComponent>().ClassName.GetString();
 		return ScriptEngine::CreateMonoString(name.c_str());
 	}
 
-	static void ScriptComponent_SetClass(UUID entityID, MonoString* name)
+	static void ScriptComponent_SetClass(ScriptEntityHandle* handle, MonoString* name)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<ScriptComponent>();
 		component.ClassName = Utils::GetStringFromMono(name);
+		entity.MarkDirty<ScriptComponent>();
 	}
 #pragma endregion
 
 #pragma region SpriteRendererComponent
-	static void SpriteRendererComponent_SetColour(UUID entityID, glm::vec4* colour)
+	static void SpriteRendererComponent_SetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<SpriteRendererComponent>().Colour = *colour;
+		entity.MarkDirty<SpriteRendererComponent>();
 	}
 
-	static void SpriteRendererComponent_GetColour(UUID entityID, glm::vec4* colour)
+	static void SpriteRendererComponent_GetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*colour = entity.GetComponent<SpriteRendererComponent>().Colour;
 	}
 
-	static void SpriteRendererComponent_SetOffset(UUID entityID, glm::vec2* offset)
+	static void SpriteRendererComponent_SetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<SpriteRendererComponent>().SubTextureOffset = *offset;
+		entity.MarkDirty<SpriteRendererComponent>();
 	}
 
-	static void SpriteRendererComponent_GetOffset(UUID entityID, glm::vec2* offset)
+	static void SpriteRendererComponent_GetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*offset = entity.GetComponent<SpriteRendererComponent>().SubTextureOffset;
 	}
 
-	static void SpriteRendererComponent_SetCellSize(UUID entityID, glm::vec2* size)
+	static void SpriteRendererComponent_SetCellSize(ScriptEntityHandle* handle, glm::vec2* size)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<SpriteRendererComponent>().SubTextureCellSize = *size;
+		entity.MarkDirty<SpriteRendererComponent>();
 	}
 
-	static void SpriteRendererComponent_GetCellSize(UUID entityID, glm::vec2* size)
+	static void SpriteRendererComponent_GetCellSize(ScriptEntityHandle* handle, glm::vec2* size)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*size = entity.GetComponent<SpriteRendererComponent>().SubTextureCellSize;
 	}
 
-	static void SpriteRendererComponent_SetCellNumber(UUID entityID, glm::vec2* number)
+	static void SpriteRendererComponent_SetCellNumber(ScriptEntityHandle* handle, glm::vec2* number)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<SpriteRendererComponent>().SubTextureCellNum = *number;
+		entity.MarkDirty<SpriteRendererComponent>();
 	}
 
-	static void SpriteRendererComponent_GetCellNumber(UUID entityID, glm::vec2* number)
+	static void SpriteRendererComponent_GetCellNumber(ScriptEntityHandle* handle, glm::vec2* number)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*number = entity.GetComponent<SpriteRendererComponent>().SubTextureCellNum;
 	}
 
-	static void SpriteRendererComponent_SetTiling(UUID entityID, float tiling)
+	static void SpriteRendererComponent_SetTiling(ScriptEntityHandle* handle, float tiling)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<SpriteRendererComponent>().Tiling = tiling;
+		entity.MarkDirty<SpriteRendererComponent>();
 	}
 
-	static float SpriteRendererComponent_GetTiling(UUID entityID)
+	static float SpriteRendererComponent_GetTiling(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<SpriteRendererComponent>().Tiling;
@@ -713,81 +843,85 @@ namespace Nebula {
 #pragma endregion
 
 #pragma region CircleRendererComponent
-	static void CircleRendererComponent_SetColour(UUID entityID, glm::vec4* colour)
+	static void CircleRendererComponent_SetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<CircleRendererComponent>().Colour = *colour;
+		entity.MarkDirty<CircleRendererComponent>();
 	}
 
-	static void CircleRendererComponent_GetColour(UUID entityID, glm::vec4* colour)
+	static void CircleRendererComponent_GetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*colour = entity.GetComponent<CircleRendererComponent>().Colour;
 	}
 
-	static void CircleRendererComponent_SetRadius(UUID entityID, float radius)
+	static void CircleRendererComponent_SetRadius(ScriptEntityHandle* handle, float radius)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<CircleRendererComponent>().Radius = radius;
+		entity.MarkDirty<CircleRendererComponent>();
 	}
 
-	static float CircleRendererComponent_GetRadius(UUID entityID)
+	static float CircleRendererComponent_GetRadius(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<CircleRendererComponent>().Radius;
 	}
 
-	static void CircleRendererComponent_SetThickness(UUID entityID, float thickness)
+	static void CircleRendererComponent_SetThickness(ScriptEntityHandle* handle, float thickness)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<CircleRendererComponent>().Thickness = thickness;
+		entity.MarkDirty<CircleRendererComponent>();
 	}
 
-	static float CircleRendererComponent_GetThickness(UUID entityID)
+	static float CircleRendererComponent_GetThickness(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<CircleRendererComponent>().Thickness;
 	}
 
-	static void CircleRendererComponent_SetFade(UUID entityID, float fade)
+	static void CircleRendererComponent_SetFade(ScriptEntityHandle* handle, float fade)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		entity.GetComponent<CircleRendererComponent>().Fade = fade;
+		entity.MarkDirty<CircleRendererComponent>();
 	}
 
-	static float CircleRendererComponent_GetFade(UUID entityID)
+	static float CircleRendererComponent_GetFade(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<CircleRendererComponent>().Fade;
@@ -795,151 +929,158 @@ namespace Nebula {
 #pragma endregion
 
 #pragma region StringRendererComponent
-	static void StringRendererComponent_SetText(UUID entityID, MonoString* text)
+	static void StringRendererComponent_SetText(ScriptEntityHandle* handle, MonoString* text)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.Text = Utils::GetStringFromMono(text);
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static MonoString* StringRendererComponent_GetText(UUID entityID)
+	static MonoString* StringRendererComponent_GetText(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		std::string text = entity.GetComponent<StringRendererComponent>().Text;
 		return ScriptEngine::CreateMonoString(text.c_str());
 	}
 
-	static void StringRendererComponent_SetColour(UUID entityID, glm::vec4* colour)
+	static void StringRendererComponent_SetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.Colour = *colour;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static void StringRendererComponent_GetColour(UUID entityID, glm::vec4* colour)
+	static void StringRendererComponent_GetColour(ScriptEntityHandle* handle, glm::vec4* colour)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		*colour = entity.GetComponent<StringRendererComponent>().Colour;
 	}
 
-	static void StringRendererComponent_SetFontHandle(UUID entityID, AssetHandle handle)
+	static void StringRendererComponent_SetFontHandle(ScriptEntityHandle* handle, AssetHandle handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.FontHandle = handle;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static uint64_t StringRendererComponent_GetFontHandle(UUID entityID)
+	static uint64_t StringRendererComponent_GetFontHandle(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		return component.FontHandle;
 	}
 
-	static void StringRendererComponent_SetBold(UUID entityID, bool bold)
+	static void StringRendererComponent_SetBold(ScriptEntityHandle* handle, bool bold)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.Bold = bold;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static bool StringRendererComponent_GetBold(UUID entityID)
+	static bool StringRendererComponent_GetBold(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<StringRendererComponent>().Bold;
 	}
 
-	static void StringRendererComponent_SetItalic(UUID entityID, bool italic)
+	static void StringRendererComponent_SetItalic(ScriptEntityHandle* handle, bool italic)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.Italic = italic;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static bool StringRendererComponent_GetItalic(UUID entityID)
+	static bool StringRendererComponent_GetItalic(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		return entity.GetComponent<StringRendererComponent>().Italic;
 	}
 
-	static void StringRendererComponent_SetKerning(UUID entityID, float kerning)
+	static void StringRendererComponent_SetKerning(ScriptEntityHandle* handle, float kerning)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.Kerning = kerning;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 
-	static float StringRendererComponent_GetKerning(UUID entityID)
+	static float StringRendererComponent_GetKerning(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		return component.Kerning;
 	}
 	
-	static void StringRendererComponent_SetLineSpacing(UUID entityID, float lineSpacing)
+	static void StringRendererComponent_SetLineSpacing(ScriptEntityHandle* handle, float lineSpacing)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
 		component.LineSpacing = lineSpacing;
+		entity.MarkDirty<StringRendererComponent>();
 	}
 	
-	static float StringRendererComponent_GetLineSpacing(UUID entityID)
+	static float StringRendererComponent_GetLineSpacing(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<StringRendererComponent>();
@@ -948,21 +1089,21 @@ namespace Nebula {
 #pragma endregion
 
 #pragma region Rigidbody2DComponent
-	static int Rigidbody2DComponent_GetBodyType(UUID entityID) {
+	static int Rigidbody2DComponent_GetBodyType(ScriptEntityHandle* handle) {
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<Rigidbody2DComponent>();
 		return (int)component.Type;
 	}
 
-	static void Rigidbody2DComponent_SetBodyType(UUID entityID, int type) 
+	static void Rigidbody2DComponent_SetBodyType(ScriptEntityHandle* handle, int type) 
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<Rigidbody2DComponent>();
@@ -970,57 +1111,59 @@ namespace Nebula {
 
 		b2Body* body = (b2Body*)component.RuntimeBody;
 		body->SetType(Utils::Rigibody2DToBox2D(component.Type));
+		entity.MarkDirty<Rigidbody2DComponent>();
 	}
 
-	static bool Rigidbody2DComponent_GetFixedRotation(UUID entityID)
+	static bool Rigidbody2DComponent_GetFixedRotation(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<Rigidbody2DComponent>();
 		return component.FixedRotation;
 	}
 
-	static void Rigidbody2DComponent_SetFixedRotation(UUID entityID, bool fixedRotation) 
+	static void Rigidbody2DComponent_SetFixedRotation(ScriptEntityHandle* handle, bool fixedRotation) 
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<Rigidbody2DComponent>();
 		component.FixedRotation = fixedRotation;
+		entity.MarkDirty<Rigidbody2DComponent>();
 	}
 
-	static void Rigidbody2DComponent_ApplyLinearImpulse(UUID entityID, glm::vec2* impulse, glm::vec2* point)
+	static void Rigidbody2DComponent_ApplyLinearImpulse(ScriptEntityHandle* handle, glm::vec2* impulse, glm::vec2* point)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& rigidbody = entity.GetComponent<Rigidbody2DComponent>();
 		rigidbody.ApplyLinearImpulse(*impulse, *point);
 	}
 
-	static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(UUID entityID, glm::vec2* impulse)
+	static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(ScriptEntityHandle* handle, glm::vec2* impulse)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& rigidbody = entity.GetComponent<Rigidbody2DComponent>();
 		rigidbody.ApplyLinearImpulseToCenter(*impulse);
 	}
 
-	static void Rigidbody2DComponent_GetLinearVelocity(UUID entityID, glm::vec2* out)
+	static void Rigidbody2DComponent_GetLinearVelocity(ScriptEntityHandle* handle, glm::vec2* out)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& rigidbody = entity.GetComponent<Rigidbody2DComponent>();
@@ -1029,22 +1172,22 @@ namespace Nebula {
 		*out = glm::vec2(linearVecolity.x, linearVecolity.y);
 	}
 
-	static void Rigidbody2DComponent_ApplyForce(UUID entityID, glm::vec2* force, glm::vec2* point)
+	static void Rigidbody2DComponent_ApplyForce(ScriptEntityHandle* handle, glm::vec2* force, glm::vec2* point)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& rigidbody = entity.GetComponent<Rigidbody2DComponent>();
 		rigidbody.ApplyForce(*force, *point);
 	}
 
-	static void Rigidbody2DComponent_ApplyForceToCenter(UUID entityID, glm::vec2* force)
+	static void Rigidbody2DComponent_ApplyForceToCenter(ScriptEntityHandle* handle, glm::vec2* force)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& rigidbody = entity.GetComponent<Rigidbody2DComponent>();
@@ -1053,314 +1196,328 @@ namespace Nebula {
 #pragma endregion
 
 #pragma region BoxCollider2DComponent
-	static void BoxCollider2DComponent_GetSize(UUID entityID, glm::vec2* size)
+	static void BoxCollider2DComponent_GetSize(ScriptEntityHandle* handle, glm::vec2* size)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		*size = component.Size;
 	}
 
-	static void BoxCollider2DComponent_SetSize(UUID entityID, glm::vec2* size)
+	static void BoxCollider2DComponent_SetSize(ScriptEntityHandle* handle, glm::vec2* size)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Size = *size;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 
-	static void BoxCollider2DComponent_GetOffset(UUID entityID, glm::vec2* offset)
+	static void BoxCollider2DComponent_GetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		*offset = component.Offset;
 	}
 
-	static void BoxCollider2DComponent_SetOffset(UUID entityID, glm::vec2* offset)
+	static void BoxCollider2DComponent_SetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Offset = *offset;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 
-	static float BoxCollider2DComponent_GetDensity(UUID entityID)
+	static float BoxCollider2DComponent_GetDensity(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.Density;
 	}
 
-	static void BoxCollider2DComponent_SetDensity(UUID entityID, float density)
+	static void BoxCollider2DComponent_SetDensity(ScriptEntityHandle* handle, float density)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Density = density;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 
-	static float BoxCollider2DComponent_GetFriction(UUID entityID)
+	static float BoxCollider2DComponent_GetFriction(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.Friction;
 	}
 
-	static void BoxCollider2DComponent_SetFriction(UUID entityID, float friction)
+	static void BoxCollider2DComponent_SetFriction(ScriptEntityHandle* handle, float friction)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Friction = friction;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 
-	static float BoxCollider2DComponent_GetRestitution(UUID entityID)
+	static float BoxCollider2DComponent_GetRestitution(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.Restitution;
 	}
 
-	static void BoxCollider2DComponent_SetRestitution(UUID entityID, float restitution)
+	static void BoxCollider2DComponent_SetRestitution(ScriptEntityHandle* handle, float restitution)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Restitution = restitution;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 
-	static float BoxCollider2DComponent_GetThreshold(UUID entityID)
+	static float BoxCollider2DComponent_GetThreshold(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.RestitutionThreshold;
 	}
 
-	static void BoxCollider2DComponent_SetThreshold(UUID entityID, float threshold)
+	static void BoxCollider2DComponent_SetThreshold(ScriptEntityHandle* handle, float threshold)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.RestitutionThreshold = threshold;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 	
-	static uint16_t BoxCollider2DComponent_GetMask(UUID entityID)
+	static uint16_t BoxCollider2DComponent_GetMask(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.Mask;
 	}
 
-	static void BoxCollider2DComponent_SetMask(UUID entityID, uint16_t mask)
+	static void BoxCollider2DComponent_SetMask(ScriptEntityHandle* handle, uint16_t mask)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Mask = mask;
+		entity.MarkDirty<BoxCollider2DComponent>();
 	}
 #pragma endregion
 
 #pragma region CircleCollider2DComponent
-	static float CircleCollider2DComponent_GetRadius(UUID entityID)
+	static float CircleCollider2DComponent_GetRadius(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		return component.Radius;
 	}
 
-	static void CircleCollider2DComponent_SetRadius(UUID entityID, float radius)
+	static void CircleCollider2DComponent_SetRadius(ScriptEntityHandle* handle, float radius)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.Radius = radius;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static void CircleCollider2DComponent_GetOffset(UUID entityID, glm::vec2* offset)
+	static void CircleCollider2DComponent_GetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		*offset = component.Offset;
 	}
 
-	static void CircleCollider2DComponent_SetOffset(UUID entityID, glm::vec2* offset)
+	static void CircleCollider2DComponent_SetOffset(ScriptEntityHandle* handle, glm::vec2* offset)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.Offset = *offset;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static float CircleCollider2DComponent_GetDensity(UUID entityID)
+	static float CircleCollider2DComponent_GetDensity(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		return component.Density;
 	}
 
-	static void CircleCollider2DComponent_SetDensity(UUID entityID, float density)
+	static void CircleCollider2DComponent_SetDensity(ScriptEntityHandle* handle, float density)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.Density = density;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static float CircleCollider2DComponent_GetFriction(UUID entityID)
+	static float CircleCollider2DComponent_GetFriction(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		return component.Friction;
 	}
 
-	static void CircleCollider2DComponent_SetFriction(UUID entityID, float friction)
+	static void CircleCollider2DComponent_SetFriction(ScriptEntityHandle* handle, float friction)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.Friction = friction;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static float CircleCollider2DComponent_GetRestitution(UUID entityID)
+	static float CircleCollider2DComponent_GetRestitution(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		return component.Restitution;
 	}
 
-	static void CircleCollider2DComponent_SetRestitution(UUID entityID, float restitution)
+	static void CircleCollider2DComponent_SetRestitution(ScriptEntityHandle* handle, float restitution)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.Restitution = restitution;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static float CircleCollider2DComponent_GetThreshold(UUID entityID)
+	static float CircleCollider2DComponent_GetThreshold(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		return component.RestitutionThreshold;
 	}
 
-	static void CircleCollider2DComponent_SetThreshold(UUID entityID, float threshold)
+	static void CircleCollider2DComponent_SetThreshold(ScriptEntityHandle* handle, float threshold)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<CircleColliderComponent>();
 		component.RestitutionThreshold = threshold;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 
-	static uint16_t CircleCollider2DComponent_GetMask(UUID entityID)
+	static uint16_t CircleCollider2DComponent_GetMask(ScriptEntityHandle* handle)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		return component.Mask;
 	}
 
-	static void CircleCollider2DComponent_SetMask(UUID entityID, uint16_t mask)
+	static void CircleCollider2DComponent_SetMask(ScriptEntityHandle* handle, uint16_t mask)
 	{
 		Scene* scene = ScriptEngine::GetSceneContext();
 		NB_ASSERT(scene);
-		Entity entity = { entityID, scene };
+		Entity entity = Utils::GetEntity(scene, handle);
 		NB_ASSERT(entity);
 
 		auto& component = entity.GetComponent<BoxCollider2DComponent>();
 		component.Mask = mask;
+		entity.MarkDirty<CircleColliderComponent>();
 	}
 #pragma endregion
 
@@ -1387,6 +1544,7 @@ namespace Nebula {
 
 		NB_ADD_INTERNAL_CALL(CameraComponent_ScreenToWorld);
 		NB_ADD_INTERNAL_CALL(CameraComponent_WorldToScreen);
+		NB_ADD_INTERNAL_CALL(CameraComponent_PickEntity);
 		
 		NB_ADD_INTERNAL_CALL(Asset_GetHandleFromPath);
 		NB_ADD_INTERNAL_CALL(Asset_GetPathFromHandle);
@@ -1399,8 +1557,13 @@ namespace Nebula {
 		NB_ADD_INTERNAL_CALL(Scene_CreateNewEntity);
 		NB_ADD_INTERNAL_CALL(Scene_DuplicateEntity);
 		NB_ADD_INTERNAL_CALL(Scene_DestroyEntity);
+		NB_ADD_INTERNAL_CALL(Scene_DespawnEntity);
 
 		NB_ADD_INTERNAL_CALL(Prefab_Create);
+		NB_ADD_INTERNAL_CALL(Prefab_Instantiate);
+		NB_ADD_INTERNAL_CALL(Prefab_Spawn);
+		NB_ADD_INTERNAL_CALL(Prefab_Prewarm);
+		NB_ADD_INTERNAL_CALL(Prefab_GetPoolStats);
 
 		NB_ADD_INTERNAL_CALL(Entity_HasComponent);
 		NB_ADD_INTERNAL_CALL(Entity_AddComponent);
@@ -0,0 +1,529 @@
+#pragma once
+
+#include "Nebula/Core/API.h"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#define NB_FLAT_MAP_SSE2
+	#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+namespace Nebula {
+	namespace FlatMap {
+		// Every slot has a control byte. Full slots store the low 7 bits of their hash, the rest are negative
+		constexpr int8_t Empty = -128;
+		constexpr int8_t Deleted = -2;
+		// Sits after the last slot so iterators know where to stop
+		constexpr int8_t Sentinel = -1;
+
+		// Slots probed at once
+		constexpr size_t GroupWidth = 16;
+
+		// std::hash is the identity for integers, UUIDs and pointers, which leaves the low and high bits nearly constant
+		inline uint64_t Mix(uint64_t hash)
+		{
+			hash ^= hash >> 33;
+			hash *= 0xff51afd7ed558ccdull;
+			hash ^= hash >> 33;
+			hash *= 0xc4ceb9fe1a85ec53ull;
+			hash ^= hash >> 33;
+			return hash;
+		}
+
+		inline uint32_t LowestBit(uint32_t mask)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return (uint32_t)index;
+#else
+			return (uint32_t)__builtin_ctz(mask);
+#endif
+		}
+
+		inline uint32_t HighestBit(uint32_t mask)
+		{
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanReverse(&index, mask);
+			return (uint32_t)index;
+#else
+			return 31 - (uint32_t)__builtin_clz(mask);
+#endif
+		}
+
+		// The control bytes of GroupWidth slots, matches come back as one bit per slot
+		class Group
+		{
+		public:
+#ifdef NB_FLAT_MAP_SSE2
+			explicit Group(const int8_t* control) : m_Control(_mm_loadu_si128((const __m128i*)control)) { }
+
+			uint32_t Match(int8_t h2) const { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Control)); }
+			uint32_t MatchEmpty() const { return Match(Empty); }
+			uint32_t MatchFree() const { return (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), m_Control)); }
+		private:
+			__m128i m_Control;
+#else
+			explicit Group(const int8_t* control) { std::memcpy(m_Control, control, GroupWidth); }
+
+			uint32_t Match(int8_t h2) const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GroupWidth; i++)
+					mask |= (uint32_t)(m_Control[i] == h2) << i;
+				return mask;
+			}
+
+			uint32_t MatchEmpty() const { return Match(Empty); }
+
+			uint32_t MatchFree() const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GroupWidth; i++)
+					mask |= (uint32_t)(m_Control[i] < Sentinel) << i;
+				return mask;
+			}
+		private:
+			int8_t m_Control[GroupWidth];
+#endif
+		};
+	}
+
+	// Open addressing hash map that keeps its entries in one array, probing 16 control bytes at a time.
+	// Drop-in for the std::unordered_map calls the engine uses, except that inserting can move every entry:
+	// references, pointers and iterators don't survive an insert, erasing only invalidates the erased entry.
+	// Keys are mixed before probing, so small sequential keys lose the ordered layout std::hash gives them:
+	// inserting those and looking up absent ones is slower than std::unordered_map, everything else is faster.
+	template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class FlatHashMap
+	{
+	public:
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<const Key, Value>;
+		using size_type = size_t;
+
+		template<bool Const>
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = FlatHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using reference = std::conditional_t<Const, const value_type&, value_type&>;
+			using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+			Iterator() = default;
+
+			template<bool IsConst = Const, typename = std::enable_if_t<IsConst>>
+			Iterator(const Iterator<false>& other) : m_Control(other.m_Control), m_Slot(other.m_Slot) { }
+
+			reference operator*() const { return *m_Slot; }
+			pointer operator->() const { return m_Slot; }
+
+			Iterator& operator++()
+			{
+				m_Control++;
+				m_Slot++;
+				SkipFree();
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				Iterator it = *this;
+				++(*this);
+				return it;
+			}
+
+			bool operator==(const Iterator& other) const { return m_Slot == other.m_Slot; }
+			bool operator!=(const Iterator& other) const { return m_Slot != other.m_Slot; }
+		private:
+			Iterator(const int8_t* control, pointer slot) : m_Control(control), m_Slot(slot) { }
+
+			void SkipFree()
+			{
+				while (*m_Control < FlatMap::Sentinel)
+				{
+					m_Control++;
+					m_Slot++;
+				}
+			}
+		private:
+			const int8_t* m_Control = nullptr;
+			pointer m_Slot = nullptr;
+
+			template<bool>
+			friend class Iterator;
+			friend class FlatHashMap;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+	public:
+		FlatHashMap() = default;
+		FlatHashMap(const FlatHashMap& other) { CopyFrom(other); }
+		FlatHashMap(FlatHashMap&& other) noexcept { Swap(other); }
+		~FlatHashMap() { Release(); }
+
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other)
+			{
+				FlatHashMap copy(other);
+				Swap(copy);
+			}
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				FlatHashMap moved(std::move(other));
+				Swap(moved);
+			}
+			return *this;
+		}
+
+		iterator begin()
+		{
+			if (m_Size == 0)
+				return end();
+
+			iterator it(m_Control, m_Slots);
+			it.SkipFree();
+			return it;
+		}
+
+		const_iterator begin() const { return const_cast<FlatHashMap*>(this)->begin(); }
+		iterator end() { return iterator(m_Control + m_Capacity, m_Slots + m_Capacity); }
+		const_iterator end() const { return const_cast<FlatHashMap*>(this)->end(); }
+
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
+		// Slots allocated, entries are kept under 7/8 of it
+		size_t capacity() const { return m_Capacity; }
+
+		iterator find(const Key& key)
+		{
+			size_t index = FindIndex(key, HashOf(key));
+			return index == NotFound ? end() : At(index);
+		}
+
+		const_iterator find(const Key& key) const { return const_cast<FlatHashMap*>(this)->find(key); }
+
+		bool contains(const Key& key) const { return FindIndex(key, HashOf(key)) != NotFound; }
+		size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+		// Throws like std::unordered_map::at, the callers converted from it rely on that in release builds too
+		Value& at(const Key& key)
+		{
+			size_t index = FindIndex(key, HashOf(key));
+			NB_ASSERT(index != NotFound, "[FlatHashMap] Key not found");
+			if (index == NotFound)
+				throw std::out_of_range("[FlatHashMap] Key not found");
+
+			return m_Slots[index].second;
+		}
+
+		const Value& at(const Key& key) const { return const_cast<FlatHashMap*>(this)->at(key); }
+
+		Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+		// Leaves the map untouched if the key is already there
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+		{
+			size_t hash = HashOf(key);
+			size_t index = FindIndex(key, hash);
+			if (index != NotFound)
+				return { At(index), false };
+
+			index = PrepareInsert(hash);
+			new (m_Slots + index) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			CommitInsert(index, hash);
+			return { At(index), true };
+		}
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(const Key& key, Args&&... args) { return try_emplace(key, std::forward<Args>(args)...); }
+
+		std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+
+		size_t erase(const Key& key)
+		{
+			size_t index = FindIndex(key, HashOf(key));
+			if (index == NotFound)
+				return 0;
+
+			EraseIndex(index);
+			return 1;
+		}
+
+		iterator erase(const_iterator it)
+		{
+			iterator next(it.m_Control, const_cast<value_type*>(it.m_Slot));
+			++next;
+
+			EraseIndex(it.m_Slot - m_Slots);
+			return next;
+		}
+
+		iterator erase(iterator it) { return erase(const_iterator(it)); }
+
+		// Keeps the allocation
+		void clear()
+		{
+			if (m_Capacity == 0)
+				return;
+
+			DestroySlots();
+			ResetControl();
+			m_Size = 0;
+		}
+
+		void reserve(size_t count)
+		{
+			size_t capacity = FlatMap::GroupWidth - 1;
+			while (MaxLoad(capacity) < count)
+				capacity = capacity * 2 + 1;
+
+			if (capacity > m_Capacity)
+				Rehash(capacity);
+		}
+	private:
+		static constexpr size_t NotFound = ~(size_t)0;
+
+		// Capacities are one less than a power of two, so the capacity doubles as the probe mask
+		static size_t MaxLoad(size_t capacity) { return capacity - capacity / 8; }
+
+		static size_t HashOf(const Key& key) { return (size_t)FlatMap::Mix((uint64_t)Hash{}(key)); }
+		static size_t H1(size_t hash) { return hash >> 7; }
+		static int8_t H2(size_t hash) { return (int8_t)(hash & 0x7F); }
+
+		iterator At(size_t index) { return iterator(m_Control + index, m_Slots + index); }
+
+		void SetControl(size_t index, int8_t control)
+		{
+			m_Control[index] = control;
+
+			// The first slots are cloned after the sentinel, so a group read near the end wraps around
+			if (index < FlatMap::GroupWidth - 1)
+				m_Control[m_Capacity + 1 + index] = control;
+		}
+
+		size_t FindIndex(const Key& key, size_t hash) const
+		{
+			if (m_Capacity == 0)
+				return NotFound;
+
+			int8_t h2 = H2(hash);
+			size_t offset = H1(hash) & m_Capacity;
+
+			// Triangular steps of whole groups reach every group once the table wraps
+			for (size_t step = FlatMap::GroupWidth;; step += FlatMap::GroupWidth)
+			{
+				FlatMap::Group group(m_Control + offset);
+				for (uint32_t match = group.Match(h2); match; match &= match - 1)
+				{
+					size_t index = (offset + FlatMap::LowestBit(match)) & m_Capacity;
+					if (KeyEqual{}(m_Slots[index].first, key))
+						return index;
+				}
+
+				if (group.MatchEmpty())
+					return NotFound;
+
+				offset = (offset + step) & m_Capacity;
+			}
+		}
+
+		// First empty or deleted slot on the key's probe sequence
+		size_t FindFreeIndex(size_t hash) const
+		{
+			size_t offset = H1(hash) & m_Capacity;
+			for (size_t step = FlatMap::GroupWidth;; step += FlatMap::GroupWidth)
+			{
+				uint32_t free = FlatMap::Group(m_Control + offset).MatchFree();
+				if (free)
+					return (offset + FlatMap::LowestBit(free)) & m_Capacity;
+
+				offset = (offset + step) & m_Capacity;
+			}
+		}
+
+		size_t PrepareInsert(size_t hash)
+		{
+			if (m_Capacity == 0)
+				Rehash(FlatMap::GroupWidth - 1);
+
+			size_t index = FindFreeIndex(hash);
+
+			// Reusing a deleted slot doesn't make probes any longer
+			if (m_GrowthLeft == 0 && m_Control[index] != FlatMap::Deleted)
+			{
+				// Mostly deleted slots only need cleaning up, not more room
+				Rehash(m_Size < MaxLoad(m_Capacity) / 2 ? m_Capacity : m_Capacity * 2 + 1);
+				index = FindFreeIndex(hash);
+			}
+
+			return index;
+		}
+
+		void CommitInsert(size_t index, size_t hash)
+		{
+			if (m_Control[index] == FlatMap::Empty)
+				m_GrowthLeft--;
+
+			SetControl(index, H2(hash));
+			m_Size++;
+		}
+
+		void EraseIndex(size_t index)
+		{
+			m_Slots[index].~value_type();
+			m_Size--;
+
+			// A probe only walks past a slot inside a run of a whole group without an empty slot.
+			// Outside such a run nothing can depend on it, so it can go straight back to empty
+			size_t before = (index - FlatMap::GroupWidth) & m_Capacity;
+			uint32_t emptyAfter = FlatMap::Group(m_Control + index).MatchEmpty();
+			uint32_t emptyBefore = FlatMap::Group(m_Control + before).MatchEmpty();
+
+			bool probedPast = !emptyAfter || !emptyBefore
+				|| FlatMap::LowestBit(emptyAfter) + (FlatMap::GroupWidth - 1 - FlatMap::HighestBit(emptyBefore)) >= FlatMap::GroupWidth;
+
+			if (probedPast)
+			{
+				SetControl(index, FlatMap::Deleted);
+			}
+			else
+			{
+				SetControl(index, FlatMap::Empty);
+				m_GrowthLeft++;
+			}
+		}
+
+		void ResetControl()
+		{
+			std::memset(m_Control, (uint8_t)FlatMap::Empty, m_Capacity + FlatMap::GroupWidth);
+			m_Control[m_Capacity] = FlatMap::Sentinel;
+			m_GrowthLeft = MaxLoad(m_Capacity);
+		}
+
+		void Allocate(size_t capacity)
+		{
+			m_Capacity = capacity;
+			m_Control = new int8_t[capacity + FlatMap::GroupWidth];
+			m_Slots = std::allocator<value_type>().allocate(capacity);
+			ResetControl();
+		}
+
+		void Rehash(size_t capacity)
+		{
+			int8_t* oldControl = m_Control;
+			value_type* oldSlots = m_Slots;
+			size_t oldCapacity = m_Capacity;
+
+			Allocate(capacity);
+
+			for (size_t i = 0; i < oldCapacity; i++)
+			{
+				if (oldControl[i] < 0)
+					continue;
+
+				value_type& slot = oldSlots[i];
+				size_t hash = HashOf(slot.first);
+				size_t index = FindFreeIndex(hash);
+
+				new (m_Slots + index) value_type(std::move(const_cast<Key&>(slot.first)), std::move(slot.second));
+				slot.~value_type();
+
+				SetControl(index, H2(hash));
+				m_GrowthLeft--;
+			}
+
+			if (oldCapacity)
+			{
+				std::allocator<value_type>().deallocate(oldSlots, oldCapacity);
+				delete[] oldControl;
+			}
+		}
+
+		void CopyFrom(const FlatHashMap& other)
+		{
+			if (other.m_Capacity == 0)
+				return;
+
+			Allocate(other.m_Capacity);
+			std::memcpy(m_Control, other.m_Control, m_Capacity + FlatMap::GroupWidth);
+
+			for (size_t i = 0; i < m_Capacity; i++)
+			{
+				if (m_Control[i] >= 0)
+					new (m_Slots + i) value_type(other.m_Slots[i]);
+			}
+
+			m_Size = other.m_Size;
+			m_GrowthLeft = other.m_GrowthLeft;
+		}
+
+		void DestroySlots()
+		{
+			if constexpr (std::is_trivially_destructible_v<value_type>)
+				return;
+
+			for (size_t i = 0; i < m_Capacity; i++)
+			{
+				if (m_Control[i] >= 0)
+					m_Slots[i].~value_type();
+			}
+		}
+
+		void Release()
+		{
+			if (m_Capacity == 0)
+				return;
+
+			DestroySlots();
+			std::allocator<value_type>().deallocate(m_Slots, m_Capacity);
+			delete[] m_Control;
+
+			m_Control = nullptr;
+			m_Slots = nullptr;
+			m_Capacity = m_Size = m_GrowthLeft = 0;
+		}
+
+		void Swap(FlatHashMap& other) noexcept
+		{
+			std::swap(m_Control, other.m_Control);
+			std::swap(m_Slots, other.m_Slots);
+			std::swap(m_Capacity, other.m_Capacity);
+			std::swap(m_Size, other.m_Size);
+			std::swap(m_GrowthLeft, other.m_GrowthLeft);
+		}
+	private:
+		int8_t* m_Control = nullptr;
+		value_type* m_Slots = nullptr;
+
+		size_t m_Capacity = 0;
+		size_t m_Size = 0;
+		// Empty slots that can still be filled before the load limit
+		size_t m_GrowthLeft = 0;
+	};
+}
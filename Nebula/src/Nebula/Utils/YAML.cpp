@@ -22,6 +22,11 @@ namespace Nebula
 		return out;
 	}
 
+	YAML::Emitter& operator<<(YAML::Emitter& out, const NameID& name) {
+		out << name.GetString();
+		return out;
+	}
+
 	std::string RigidBody2DBodyTypeToString(Rigidbody2DComponent::BodyType bodyType)
 	{
 		switch (bodyType)
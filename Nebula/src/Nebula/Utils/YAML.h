@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Nebula/Core/UUID.h"
+#include "Nebula/Core/NameID.h"
 #include "Nebula/Scene/Components.h"
 
 #include <yaml-cpp/yaml.h>
@@ -99,6 +100,22 @@ namespace YAML
 		}
 	};
 
+	// Names are written as their text, ids are only valid for one run
+	template<>
+	struct convert<Nebula::NameID>
+	{
+		static Node encode(const Nebula::NameID& name)
+		{
+			return Node(name.GetString());
+		}
+
+		static bool decode(const Node& node, Nebula::NameID& name)
+		{
+			name = node.as<std::string>();
+			return true;
+		}
+	};
+
 	template<>
 	struct convert<std::filesystem::path>
 	{
@@ -122,6 +139,7 @@ namespace Nebula
 	YAML::Emitter& operator<<(YAML::Emitter& out, const glm::vec2& v);
 	YAML::Emitter& operator<<(YAML::Emitter& out, const glm::vec3& v);
 	YAML::Emitter& operator<<(YAML::Emitter& out, const glm::vec4& v);
+	YAML::Emitter& operator<<(YAML::Emitter& out, const NameID& name);
 
 	std::string RigidBody2DBodyTypeToString(Rigidbody2DComponent::BodyType bodyType);
 	Rigidbody2DComponent::BodyType RigidBody2DBodyTypeFromString(const std::string& bodyTypeString);
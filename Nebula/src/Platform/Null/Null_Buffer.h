@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Nebula/renderer/Buffer.h"
+
+namespace Nebula {
+	class Null_VertexBuffer : public VertexBuffer {
+	public:
+		void Bind()   const override { }
+		void Unbind() const override { }
+		void SetData(const void* data, uint32_t size = 0) override { }
+
+		const BufferLayout GetLayout() const override { return m_Layout; }
+		void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+	private:
+		BufferLayout m_Layout;
+	};
+
+	class Null_IndexBuffer : public IndexBuffer {
+	public:
+		Null_IndexBuffer(uint32_t count) : m_Count(count) { }
+
+		void Bind()   const override { }
+		void Unbind() const override { }
+
+		uint32_t GetCount() const override { return m_Count; }
+	private:
+		uint32_t m_Count;
+	};
+}
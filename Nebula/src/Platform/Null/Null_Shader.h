@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Nebula/renderer/Shader.h"
+
+namespace Nebula {
+	class Null_Shader: public Shader {
+	public:
+		Null_Shader(const std::string& name) : m_Name(name) { }
+
+		void Bind() const override { }
+		void Unbind() const override { }
+
+		const std::string& GetName() const override { return m_Name; }
+
+		void SetInt(const std::string& name, int value) override { }
+		void SetIntArray(const std::string& name, int* values, uint32_t count) override { }
+		void SetFloat(const std::string& name, float value) override { }
+		void SetFloat2(const std::string& name, const glm::vec2& value) override { }
+		void SetFloat3(const std::string& name, const glm::vec3& value) override { }
+		void SetFloat4(const std::string& name, const glm::vec4& value) override { }
+		void SetMat4(const std::string& name, const glm::mat4& value) override { }
+	private:
+		std::string m_Name;
+	};
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Nebula/renderer/Texture.h"
+
+namespace Nebula {
+	class Null_Texture2D : public Texture2D {
+	public:
+		Null_Texture2D(const TextureSpecification& specification)
+			: m_Specification(specification)
+		{
+			// Textures are compared by id when batching
+			static uint32_t s_NextID = 1;
+			m_RendererID = s_NextID++;
+		}
+
+		const TextureSpecification& GetSpecification() const override { return m_Specification; }
+
+		void SetData(Buffer data) override { }
+		void SetFilterNearest(bool nearest) override { }
+		
+		uint32_t GetWidth() const override { return m_Specification.Width; }
+		uint32_t GetHeight() const override { return m_Specification.Height; }
+		uint32_t GetRendererID() const override { return m_RendererID; }
+		
+		void Bind(uint32_t slot) const override { }
+		void Unbind() const override { }
+
+		bool IsLoaded() const override { return true; }
+
+		bool operator==(const Texture& other) const override {
+			return m_RendererID == other.GetRendererID();
+		}
+	private:
+		TextureSpecification m_Specification;
+		uint32_t m_RendererID;
+	};
+}
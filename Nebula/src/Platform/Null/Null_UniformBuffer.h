@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Nebula/Renderer/UniformBuffer.h"
+
+namespace Nebula {
+	class Null_UniformBuffer : public UniformBuffer
+	{
+	public:
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override { }
+	};
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Nebula/renderer/Vertex_Array.h"
+
+namespace Nebula {
+	class Null_VertexArray : public VertexArray {
+	public:
+		void Bind() const override { }
+		void Unbind() const override { }
+
+		void AddVertexBuffer(const Ref<VertexBuffer>& buffer) override { m_VertexBuffers.push_back(buffer); }
+		void SetIndexBuffer(const Ref<IndexBuffer>& buffer) override { m_IndexBuffer = buffer; }
+
+		const Array<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+		const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+	private:
+		Array<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+}
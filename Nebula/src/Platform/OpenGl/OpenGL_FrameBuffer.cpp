@@ -8,54 +8,6 @@ namespace Nebula {
 	static const uint32_t s_MaxFrameBufferSize = 8192;
 
 	namespace Utils {
-		static GLenum TextureTarget(bool multipsampled) {
-			return multipsampled ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
-		}
-
-		static void CreateTextures(bool multisampled, uint32_t* outID, uint32_t count) {
-			glCreateTextures(TextureTarget(multisampled), count, outID);
-		}
-
-		static void BindTexture(bool multisampled, uint32_t id) {
-			glBindTexture(TextureTarget(multisampled), id);
-		}
-
-		static void AttachColourTexture(uint32_t id, int samples, GLenum internalFormat, GLenum format, uint32_t width, uint32_t height, int index) {
-			bool multisampled = samples > 1;
-			if (multisampled) {
-				glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, format, width, height, GL_FALSE);
-			}
-			else {
-				glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, nullptr);
-
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			}
-
-			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, TextureTarget(multisampled), id, 0);
-		}
-
-		static void AttachDepthTexture(uint32_t id, int samples, GLenum format, GLenum attachmentType, uint32_t width, uint32_t height) {
-			bool multisampled = samples > 1;
-			if (multisampled) {
-				glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, samples, format, width, height, GL_FALSE);
-			}
-			else {
-				glTexStorage2D(GL_TEXTURE_2D, 1, format, width, height);
-
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			}
-
-			glFramebufferTexture2D(GL_FRAMEBUFFER, attachmentType , TextureTarget(multisampled), id, 0);
-		}
-
 		static bool IsDepthFormat(FramebufferTextureFormat format) {
 			switch (format)
 			{
@@ -75,6 +27,18 @@ namespace Nebula {
 			NB_ASSERT(false, "");
 			return 0;
 		}
+
+		static GLenum NebulaFBFormattoGLInternal(FramebufferTextureFormat format) {
+			switch (format)
+			{
+				case Nebula::FramebufferTextureFormat::RGBA8:			return GL_RGBA8;
+				case Nebula::FramebufferTextureFormat::RED_INT:			return GL_R32I;
+				case Nebula::FramebufferTextureFormat::DEPTH24STENCIL8: return GL_DEPTH24_STENCIL8;
+			}
+
+			NB_ASSERT(false, "");
+			return 0;
+		}
 	}
 
 	OpenGL_FrameBuffer::OpenGL_FrameBuffer(const FrameBufferSpecification& specifications): m_Specifications(specifications) {
@@ -90,66 +54,60 @@ namespace Nebula {
 
 	OpenGL_FrameBuffer::~OpenGL_FrameBuffer() {
 		glDeleteFramebuffers(1, &m_RendererID);
-		glDeleteTextures((GLsizei)m_ColourAttachments.size(), m_ColourAttachments.data());
-		glDeleteTextures(1, &m_DepthAttachment);
+
+		for (auto& attachment : m_ColourAttachments)
+			OpenGL_RenderTargetPool::Release(attachment);
+		OpenGL_RenderTargetPool::Release(m_DepthAttachment);
+
+		for (uint32_t i = 0; i < 2; i++) {
+			if (m_PixelFences[i])
+				glDeleteSync((GLsync)m_PixelFences[i]);
+		}
+
+		if (m_PixelBuffers[0])
+			glDeleteBuffers(2, m_PixelBuffers);
 	}
 
 	void OpenGL_FrameBuffer::Invalidate() {
-		if (m_RendererID) {
-			glDeleteFramebuffers(1, &m_RendererID);
-			glDeleteTextures((GLsizei)m_ColourAttachments.size(), m_ColourAttachments.data());
-			glDeleteTextures(1, &m_DepthAttachment);
+		NB_PROFILE_FUNCTION();
 
-			m_ColourAttachments.clear();
-			m_DepthAttachment = 0;
-		}
+		// Hand the old attachments back first so a framebuffer can pick up its own textures again
+		for (auto& attachment : m_ColourAttachments)
+			OpenGL_RenderTargetPool::Release(attachment);
+		OpenGL_RenderTargetPool::Release(m_DepthAttachment);
 
-		glCreateFramebuffers(1, &m_RendererID);
-		glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+		if (!m_RendererID)
+			glCreateFramebuffers(1, &m_RendererID);
 
-		bool multiSample = m_Specifications.samples > 1;
-
-		if (m_ColourAttachmentSpecs.size()) {
-			m_ColourAttachments.resize(m_ColourAttachmentSpecs.size());
-			Utils::CreateTextures(multiSample, m_ColourAttachments.data(), (GLsizei)m_ColourAttachments.size());
-
-			for (size_t i = 0; i < m_ColourAttachments.size(); i++) {
-				Utils::BindTexture(multiSample, m_ColourAttachments[i]);
-				switch (m_ColourAttachmentSpecs[i].TextureFormat) {
-					case FramebufferTextureFormat::RGBA8:
-						Utils::AttachColourTexture(m_ColourAttachments[i], m_Specifications.samples, GL_RGBA8, GL_RGBA, m_Specifications.Width, m_Specifications.Height, (int)i);
-						break;
-					case FramebufferTextureFormat::RED_INT:
-						Utils::AttachColourTexture(m_ColourAttachments[i], m_Specifications.samples, GL_R32I, GL_RED_INTEGER, m_Specifications.Width, m_Specifications.Height, (int)i);
-						break;
-				}
-			}
+		uint32_t width = m_Specifications.Width, height = m_Specifications.Height;
+		uint32_t samples = m_Specifications.samples;
+
+		m_ColourAttachments.resize(m_ColourAttachmentSpecs.size());
+		for (size_t i = 0; i < m_ColourAttachments.size(); i++) {
+			GLenum format = Utils::NebulaFBFormattoGLInternal(m_ColourAttachmentSpecs[i].TextureFormat);
+			m_ColourAttachments[i] = OpenGL_RenderTargetPool::Acquire(format, width, height, samples);
+
+			glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0 + (GLenum)i, m_ColourAttachments[i].RendererID, 0);
 		}
 
 		if (m_DepthAttachmentSpec.TextureFormat != FramebufferTextureFormat::None) {
-			Utils::CreateTextures(multiSample, &m_DepthAttachment, 1);
-			Utils::BindTexture(multiSample, m_DepthAttachment);
-			switch (m_DepthAttachmentSpec.TextureFormat)
-			{
-			case FramebufferTextureFormat::DEPTH24STENCIL8:
-				Utils::AttachDepthTexture(m_DepthAttachment, m_Specifications.samples, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, m_Specifications.Width, m_Specifications.Height);
-				break;
-			}
+			GLenum format = Utils::NebulaFBFormattoGLInternal(m_DepthAttachmentSpec.TextureFormat);
+			m_DepthAttachment = OpenGL_RenderTargetPool::Acquire(format, width, height, samples);
+
+			glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment.RendererID, 0);
 		}
 
 		if (m_ColourAttachments.size() > 1) {
 			NB_ASSERT(m_ColourAttachments.size() <= 4, "");
 			GLenum buffers[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
 
-			glDrawBuffers((GLsizei)m_ColourAttachments.size(), buffers);
+			glNamedFramebufferDrawBuffers(m_RendererID, (GLsizei)m_ColourAttachments.size(), buffers);
 		}
 		else if (m_ColourAttachments.empty()) {
-			glDrawBuffer(GL_NONE);
+			glNamedFramebufferDrawBuffer(m_RendererID, GL_NONE);
 		}
 
-		NB_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer creation failed!")
-
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		NB_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer creation failed!")
 	}
 
 	void OpenGL_FrameBuffer::Bind() {
@@ -170,9 +128,24 @@ namespace Nebula {
 		m_Specifications.Width = width;
 		m_Specifications.Height = height;
 
+		// Still fits the current bucket, Bind() only needs to shrink the viewport
+		uint32_t bucketWidth = OpenGL_RenderTargetPool::GetBucketSize(width);
+		uint32_t bucketHeight = OpenGL_RenderTargetPool::GetBucketSize(height);
+
+		const auto& current = m_ColourAttachments.empty() ? m_DepthAttachment : m_ColourAttachments[0];
+		if (current.Width == bucketWidth && current.Height == bucketHeight)
+			return;
+
 		Invalidate();
 	}
 
+	glm::vec2 OpenGL_FrameBuffer::GetAttachmentUV() const {
+		const auto& current = m_ColourAttachments.empty() ? m_DepthAttachment : m_ColourAttachments[0];
+		if (!current.Width || !current.Height)
+			return { 1.0f, 1.0f };
+
+		return { (float)m_Specifications.Width / current.Width, (float)m_Specifications.Height / current.Height };
+	}
 
 	int OpenGL_FrameBuffer::ReadPixel(uint32_t attachmentIndex, int x, int y) {
 		NB_ASSERT(attachmentIndex < m_ColourAttachments.size(), "Index is greater than Attachment Size");
@@ -183,11 +156,46 @@ namespace Nebula {
 		return pixelData;
 	}
 
+	void OpenGL_FrameBuffer::RequestPixel(uint32_t attachmentIndex, int x, int y) {
+		NB_ASSERT(attachmentIndex < m_ColourAttachments.size(), "Index is greater than Attachment Size");
+
+		if (!m_PixelBuffers[0]) {
+			glCreateBuffers(2, m_PixelBuffers);
+			for (uint32_t i = 0; i < 2; i++)
+				glNamedBufferData(m_PixelBuffers[i], sizeof(int), nullptr, GL_STREAM_READ);
+		}
+
+		// Collect last frame's request if the gpu has finished with it, otherwise keep the previous result
+		uint32_t readIndex = (m_PixelBufferIndex + 1) % 2;
+		if (GLsync fence = (GLsync)m_PixelFences[readIndex]) {
+			GLenum status = glClientWaitSync(fence, 0, 0);
+			if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+				glGetNamedBufferSubData(m_PixelBuffers[readIndex], 0, sizeof(int), &m_RequestedPixel);
+				glDeleteSync(fence);
+				m_PixelFences[readIndex] = nullptr;
+			}
+		}
+
+		uint32_t writeIndex = m_PixelBufferIndex;
+		if (m_PixelFences[writeIndex]) {
+			glDeleteSync((GLsync)m_PixelFences[writeIndex]);
+			m_PixelFences[writeIndex] = nullptr;
+		}
+
+		glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, m_PixelBuffers[writeIndex]);
+		glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_INT, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		m_PixelFences[writeIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_PixelBufferIndex = readIndex;
+	}
+
 	void OpenGL_FrameBuffer::ClearAttachment(uint32_t attachmentIndex, int value) {
 		NB_ASSERT(attachmentIndex < m_ColourAttachments.size(), "");
 
 		auto& spec = m_ColourAttachmentSpecs[attachmentIndex];
-		glClearTexImage(m_ColourAttachments[attachmentIndex], 0, 
+		glClearTexImage(m_ColourAttachments[attachmentIndex].RendererID, 0, 
 			Utils::NebulaFBFormattoGL(spec.TextureFormat), GL_INT, &value);
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Nebula/Renderer/FrameBuffer.h"
+#include "OpenGL_RenderTargetPool.h"
 
 namespace Nebula {
 	class OpenGL_FrameBuffer : public FrameBuffer {
@@ -11,6 +12,9 @@ namespace Nebula {
 		void Resize(uint32_t width, uint32_t height) override;
 		int ReadPixel(uint32_t attachmentIndex, int x, int y) override;
 
+		void RequestPixel(uint32_t attachmentIndex, int x, int y) override;
+		int GetRequestedPixel() const override { return m_RequestedPixel; }
+
 		void ClearAttachment(uint32_t attachmentIndex, int value) override;
 		
 		void Invalidate();
@@ -18,7 +22,8 @@ namespace Nebula {
 		void Bind() override;
 		void Unbind() override;
 
-		uint32_t GetColourAttachmentRendererID(uint32_t index) const override { NB_ASSERT(index < m_ColourAttachments.size(), "Index is greater than Array Size"); return m_ColourAttachments[index]; }
+		uint32_t GetColourAttachmentRendererID(uint32_t index) const override { NB_ASSERT(index < m_ColourAttachments.size(), "Index is greater than Array Size"); return m_ColourAttachments[index].RendererID; }
+		glm::vec2 GetAttachmentUV() const override;
 
 		FrameBufferSpecification& GetFrameBufferSpecifications() override { return m_Specifications; }
 		const FrameBufferSpecification& GetFrameBufferSpecifications() const override { return m_Specifications; }
@@ -29,7 +34,12 @@ namespace Nebula {
 		Array<FramebufferTextureSpecification> m_ColourAttachmentSpecs;
 		FramebufferTextureSpecification m_DepthAttachmentSpec = FramebufferTextureFormat::None;
 
-		std::vector<uint32_t> m_ColourAttachments;
-		uint32_t m_DepthAttachment = 0;
+		Array<OpenGL_RenderTargetPool::RenderTarget> m_ColourAttachments;
+		OpenGL_RenderTargetPool::RenderTarget m_DepthAttachment;
+
+		uint32_t m_PixelBuffers[2] = { 0, 0 };
+		void* m_PixelFences[2] = { nullptr, nullptr };
+		uint32_t m_PixelBufferIndex = 0;
+		int m_RequestedPixel = -1;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "nbpch.h"
+#include "OpenGL_RenderTargetPool.h"
+
+#include <glad/glad.h>
+
+namespace Nebula {
+	static const uint32_t s_MinBucketSize = 64;
+	static const uint32_t s_MaxBucketSize = 8192;
+	static const uint32_t s_MaxFreeTargets = 8;
+	// Long enough to cover a viewport being dragged back and forth between buckets
+	static const uint32_t s_MaxIdleFrames = 120;
+
+	Array<OpenGL_RenderTargetPool::RenderTarget> OpenGL_RenderTargetPool::s_FreeTargets;
+	FrameBufferPoolStats OpenGL_RenderTargetPool::s_Stats;
+	uint32_t OpenGL_RenderTargetPool::s_Frame = 0;
+
+	namespace Utils {
+		// Every attachment format the framebuffer supports is 32 bits per sample
+		static uint64_t RenderTargetSize(const OpenGL_RenderTargetPool::RenderTarget& target) {
+			return (uint64_t)target.Width * target.Height * target.Samples * 4;
+		}
+
+		static void DeleteRenderTarget(OpenGL_RenderTargetPool::RenderTarget& target, FrameBufferPoolStats& stats) {
+			glDeleteTextures(1, &target.RendererID);
+
+			stats.BytesAllocated -= RenderTargetSize(target);
+			stats.TexturesAllocated--;
+			target.RendererID = 0;
+		}
+	}
+
+	uint32_t OpenGL_RenderTargetPool::GetBucketSize(uint32_t size) {
+		uint32_t bucket = s_MinBucketSize;
+		while (bucket < size && bucket < s_MaxBucketSize)
+			bucket <<= 1;
+
+		return bucket;
+	}
+
+	OpenGL_RenderTargetPool::RenderTarget OpenGL_RenderTargetPool::Acquire(uint32_t internalFormat, uint32_t width, uint32_t height, uint32_t samples) {
+		NB_PROFILE_FUNCTION();
+
+		width = GetBucketSize(width);
+		height = GetBucketSize(height);
+
+		for (size_t i = 0; i < s_FreeTargets.size(); i++) {
+			RenderTarget& target = s_FreeTargets[i];
+			if (target.InternalFormat == internalFormat && target.Width == width
+				&& target.Height == height && target.Samples == samples)
+			{
+				RenderTarget found = target;
+				s_FreeTargets.remove_index(i);
+
+				s_Stats.Hits++;
+				return found;
+			}
+		}
+
+		RenderTarget target;
+		target.InternalFormat = internalFormat;
+		target.Width = width;
+		target.Height = height;
+		target.Samples = samples;
+
+		if (samples > 1) {
+			glCreateTextures(GL_TEXTURE_2D_MULTISAMPLE, 1, &target.RendererID);
+			glTextureStorage2DMultisample(target.RendererID, samples, internalFormat, width, height, GL_FALSE);
+		}
+		else {
+			glCreateTextures(GL_TEXTURE_2D, 1, &target.RendererID);
+			glTextureStorage2D(target.RendererID, 1, internalFormat, width, height);
+
+			glTextureParameteri(target.RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(target.RendererID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(target.RendererID, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(target.RendererID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(target.RendererID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+
+		s_Stats.Misses++;
+		s_Stats.TexturesAllocated++;
+		s_Stats.BytesAllocated += Utils::RenderTargetSize(target);
+		return target;
+	}
+
+	void OpenGL_RenderTargetPool::Release(RenderTarget& target) {
+		if (!target.RendererID)
+			return;
+
+		// Oldest targets are the least likely to be asked for again
+		if (s_FreeTargets.size() >= s_MaxFreeTargets) {
+			Utils::DeleteRenderTarget(s_FreeTargets[0], s_Stats);
+			s_FreeTargets.remove_index(0);
+		}
+
+		target.ReleasedFrame = s_Frame;
+		s_FreeTargets.push_back(target);
+		target = RenderTarget();
+	}
+
+	void OpenGL_RenderTargetPool::Trim() {
+		s_Frame++;
+
+		// Free targets are kept in release order, so the idle ones are at the front
+		size_t idle = 0;
+		while (idle < s_FreeTargets.size() && s_Frame - s_FreeTargets[idle].ReleasedFrame > s_MaxIdleFrames)
+			Utils::DeleteRenderTarget(s_FreeTargets[idle++], s_Stats);
+
+		s_FreeTargets.erase(s_FreeTargets.begin(), s_FreeTargets.begin() + idle);
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Nebula/Renderer/FrameBuffer.h"
+
+namespace Nebula {
+	// Shared pool of framebuffer attachments. Textures are allocated in power of two buckets
+	// so resizing a framebuffer within its bucket, or between framebuffers, does not touch the driver.
+	class OpenGL_RenderTargetPool {
+	public:
+		struct RenderTarget {
+			uint32_t RendererID = 0;
+			uint32_t InternalFormat = 0;
+			uint32_t Width = 0, Height = 0;
+			uint32_t Samples = 1;
+			// Frame the target was handed back to the pool on
+			uint32_t ReleasedFrame = 0;
+		};
+
+		static RenderTarget Acquire(uint32_t internalFormat, uint32_t width, uint32_t height, uint32_t samples);
+		static void Release(RenderTarget& target);
+
+		// Deletes free targets that nothing has picked up for a while, called once per frame
+		static void Trim();
+
+		static uint32_t GetBucketSize(uint32_t size);
+		static const FrameBufferPoolStats& GetStats() { return s_Stats; }
+	private:
+		static Array<RenderTarget> s_FreeTargets;
+		static FrameBufferPoolStats s_Stats;
+		static uint32_t s_Frame;
+	};
+}
@@ -10,10 +10,16 @@
 
 #include <filesystem>
 
+#include "Nebula/Core/FileSystem.h"
+#include "Nebula/Core/JobSystem.h"
 #include "Nebula/Utils/Time.h"
 
 namespace Nebula {
 	namespace Utils {
+		// Part of every cache key, change these together with the matching shaderc options
+		static const char* s_VulkanCompileOptions = "vulkan_1_2;optimization_level_performance";
+		static const char* s_OpenGLCompileOptions = "opengl_4_5";
+
 		static GLenum ShaderTypeFromString(const std::string& type)
 		{
 			if (type == "vertex")
@@ -47,19 +53,6 @@ namespace Nebula {
 			return nullptr;
 		}
 
-		static const char* GetCacheDirectory()
-		{
-			// TODO: make sure the assets directory is valid
-			return "Resources/cache/shader/opengl";
-		}
-
-		static void CreateCacheDirectoryIfNeeded()
-		{
-			std::string cacheDirectory = GetCacheDirectory();
-			if (!std::filesystem::exists(cacheDirectory))
-				std::filesystem::create_directories(cacheDirectory);
-		}
-
 		static const char* GLShaderStageCachedOpenGLFileExtension(uint32_t stage)
 		{
 			switch (stage)
@@ -82,43 +75,63 @@ namespace Nebula {
 			return "";
 		}
 
+		// Both of these query the context the first time, so call them on the main thread before compiling on workers
+		static const std::string& GetDriverVersion()
+		{
+			static std::string version = std::string((const char*)glGetString(GL_VENDOR)) + ";"
+				+ (const char*)glGetString(GL_RENDERER) + ";" + (const char*)glGetString(GL_VERSION);
+			return version;
+		}
+
 		static const bool IsAmdGpu()
 		{
-			const char* vendor = (char*)glGetString(GL_VENDOR);
-			return strstr(vendor, "ATI") != nullptr;
+			static bool isAmd = strstr((const char*)glGetString(GL_VENDOR), "ATI") != nullptr;
+			return isAmd;
 		}
 
+		static bool CompileToSpirv(const std::string& source, GLenum stage, const std::string& name,
+			const shaderc::CompileOptions& options, std::vector<uint32_t>& outData)
+		{
+			NB_PROFILE_FUNCTION();
+
+			// shaderc compilers are cheap, and one per thread avoids sharing
+			shaderc::Compiler compiler;
+			shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, GLShaderStageToShaderC(stage), name.c_str(), options);
+			if (module.GetCompilationStatus() != shaderc_compilation_status_success)
+			{
+				NB_ERROR(module.GetErrorMessage());
+				NB_ASSERT(false, "");
+				return false;
+			}
+
+			outData = std::vector<uint32_t>(module.cbegin(), module.cend());
+			return true;
+		}
 	}
 
-	OpenGL_Shader::OpenGL_Shader(const std::string& filepath)
+	OpenGL_Shader::OpenGL_Shader(const std::string& filepath, bool deferCompile)
 		: m_FilePath(filepath)
 	{
 		NB_PROFILE_FUNCTION();
 
-		Utils::CreateCacheDirectoryIfNeeded();
-
-		std::string source = ReadFile(filepath);
-		auto shaderSources = PreProcess(source);
-
-		{
-			Timer timer;
-			CompileOrGetVulkanBinaries(shaderSources);
-			if (Utils::IsAmdGpu()) {
-				CreateProgramForAmd();
-			}
-			else {
-				CompileOrGetOpenGLBinaries();
-				CreateProgram();
-			}
-			NB_WARN("Shader creation took {0} ms", timer.Elapsed() * 1000);
-		}
-
 		// Extract name from filepath
 		auto lastSlash = filepath.find_last_of("/\\");
 		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
 		auto lastDot = filepath.rfind('.');
 		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
 		m_Name = filepath.substr(lastSlash, count);
+
+		std::string source = ReadFile(filepath);
+		m_ShaderSources = PreProcess(source);
+		CalculateCacheKeys();
+
+		if (deferCompile)
+			return;
+
+		Timer timer;
+		Compile();
+		Link();
+		NB_WARN("Shader creation took {0} ms", timer.Elapsed() * 1000);
 	}
 
 	OpenGL_Shader::OpenGL_Shader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -126,18 +139,12 @@ namespace Nebula {
 	{
 		NB_PROFILE_FUNCTION();
 
-		std::unordered_map<GLenum, std::string> sources;
-		sources[GL_VERTEX_SHADER] = vertexSrc;
-		sources[GL_FRAGMENT_SHADER] = fragmentSrc;
+		m_ShaderSources[GL_VERTEX_SHADER] = vertexSrc;
+		m_ShaderSources[GL_FRAGMENT_SHADER] = fragmentSrc;
+		CalculateCacheKeys();
 
-		CompileOrGetVulkanBinaries(sources);
-		if (Utils::IsAmdGpu()) {
-			CreateProgramForAmd();
-		}
-		else {
-			CompileOrGetOpenGLBinaries();
-			CreateProgram();
-		}
+		Compile();
+		Link();
 	}
 
 	OpenGL_Shader::~OpenGL_Shader()
@@ -147,6 +154,39 @@ namespace Nebula {
 		glDeleteProgram(m_RendererID);
 	}
 
+	Array<Ref<Shader>> OpenGL_Shader::Create(const Array<std::string>& paths)
+	{
+		NB_PROFILE_FUNCTION();
+
+		Utils::GetDriverVersion();
+		Utils::IsAmdGpu();
+
+		Timer timer;
+
+		// Stages compile as jobs of their own, the shader jobs run them while they wait
+		Array<Ref<OpenGL_Shader>> shaders;
+		JobCounter counter;
+		for (const std::string& path : paths)
+		{
+			Ref<OpenGL_Shader> shader = CreateRef<OpenGL_Shader>(path, true);
+			JobSystem::Submit("Compile Shader", [shader]() { shader->Compile(); }, &counter);
+			shaders.push_back(shader);
+		}
+
+		JobSystem::Wait(counter);
+
+		// Linking touches the context, so it stays on this thread
+		Array<Ref<Shader>> result;
+		for (const Ref<OpenGL_Shader>& shader : shaders)
+		{
+			shader->Link();
+			result.push_back(shader);
+		}
+
+		NB_WARN("Creating {0} shaders took {1} ms", paths.size(), timer.Elapsed() * 1000);
+		return result;
+	}
+
 	std::string OpenGL_Shader::ReadFile(const std::string& filepath)
 	{
 		NB_PROFILE_FUNCTION();
@@ -203,124 +243,153 @@ namespace Nebula {
 		return shaderSources;
 	}
 
-	void OpenGL_Shader::CompileOrGetVulkanBinaries(const std::unordered_map<GLenum, std::string>& shaderSources)
+	void OpenGL_Shader::CalculateCacheKeys()
 	{
-		GLuint program = glCreateProgram();
+		NB_PROFILE_FUNCTION();
+
+		uint64_t optionsKey = ShaderCache::Hash(Utils::s_VulkanCompileOptions);
+
+		// Stages are xor'd together so the key does not depend on map order
+		uint64_t stagesKey = 0;
+		m_StageKeys.clear();
+		for (auto&& [stage, source] : m_ShaderSources)
+		{
+			uint64_t key = ShaderCache::Combine(ShaderCache::Hash(source, optionsKey), stage);
+			m_StageKeys[stage] = key;
+			stagesKey ^= key;
+		}
+
+		uint64_t driverKey = ShaderCache::Hash(Utils::GetDriverVersion());
+		driverKey = ShaderCache::Combine(driverKey, ShaderCache::Hash(Utils::IsAmdGpu() ? "glsl" : Utils::s_OpenGLCompileOptions));
+		m_ProgramKey = ShaderCache::Combine(driverKey, stagesKey);
+	}
+
+	void OpenGL_Shader::Compile()
+	{
+		NB_PROFILE_FUNCTION();
+
+		m_HasProgramBinary = ShaderCache::FindProgram(GetCacheName(), m_ProgramKey, m_ProgramBinary);
+		if (m_HasProgramBinary)
+			return;
+
+		CompileOrGetVulkanBinaries();
+		if (Utils::IsAmdGpu())
+			CrossCompileSourceForAmd();
+		else
+			CompileOrGetOpenGLBinaries();
+	}
+
+	void OpenGL_Shader::Link()
+	{
+		NB_PROFILE_FUNCTION();
+
+		if (m_HasProgramBinary)
+		{
+			if (CreateProgramFromBinary())
+				return;
+
+			// Driver refused the binary, fall back to the stage caches
+			NB_WARN("Program binary for '{0}' was rejected, recompiling", GetCacheName());
+			ShaderCache::RemoveProgram(GetCacheName());
+			Compile();
+		}
+
+		if (Utils::IsAmdGpu())
+			CreateProgramForAmd();
+		else
+			CreateProgram();
+
+		SaveProgramBinary();
+	}
+
+	void OpenGL_Shader::CompileOrGetVulkanBinaries()
+	{
+		NB_PROFILE_FUNCTION();
 
-		shaderc::Compiler compiler;
 		shaderc::CompileOptions options;
 		options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
 		const bool optimize = true;
 		if (optimize)
 			options.SetOptimizationLevel(shaderc_optimization_level_performance);
 
-		std::filesystem::path cacheDirectory = Utils::GetCacheDirectory();
-
 		auto& shaderData = m_VulkanSPIRV;
 		shaderData.clear();
-		for (auto&& [stage, source] : shaderSources)
-		{
-			std::filesystem::path shaderFilePath = m_FilePath;
-			std::filesystem::path cachedPath = cacheDirectory / (shaderFilePath.filename().string() + Utils::GLShaderStageCachedVulkanFileExtension(stage));
 
-			std::ifstream in(cachedPath, std::ios::in | std::ios::binary);
-			if (in.is_open())
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
+		// Insert every stage up front, the map must not be modified while stages compile
+		for (auto&& [stage, source] : m_ShaderSources)
+			shaderData[stage];
 
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32_t));
-				in.read((char*)data.data(), size);
-			}
-			else
-			{
-				shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, Utils::GLShaderStageToShaderC(stage), m_FilePath.c_str(), options);
-				if (module.GetCompilationStatus() != shaderc_compilation_status_success)
-				{
-					NB_ERROR(module.GetErrorMessage());
-					NB_ASSERT(false, "");
-				}
-
-				shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
-
-				std::ofstream out(cachedPath, std::ios::out | std::ios::binary);
-				if (out.is_open())
-				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32_t));
-					out.flush();
-					out.close();
-				}
-			}
+		JobCounter counter;
+		for (auto&& [stage, source] : m_ShaderSources)
+		{
+			std::filesystem::path cachedPath = ShaderCache::GetCachePath(m_StageKeys.at(stage), Utils::GLShaderStageCachedVulkanFileExtension(stage));
+			auto& data = shaderData.at(stage);
+
+			if (ShaderCache::ReadBinary(cachedPath, data))
+				continue;
+
+			GLenum shaderStage = stage;
+			const std::string& shaderSource = source;
+			JobSystem::Submit("Compile Vulkan Stage", [&, shaderStage, cachedPath]() {
+				if (Utils::CompileToSpirv(shaderSource, shaderStage, GetCacheName(), options, data))
+					ShaderCache::WriteBinary(cachedPath, data.data(), data.size() * sizeof(uint32_t));
+			}, &counter);
 		}
 
+		JobSystem::Wait(counter);
+
 		for (auto&& [stage, data] : shaderData)
 			Reflect(stage, data);
 	}
 
 	void OpenGL_Shader::CompileOrGetOpenGLBinaries()
 	{
+		NB_PROFILE_FUNCTION();
+
 		auto& shaderData = m_OpenGLSPIRV;
 
-		shaderc::Compiler compiler;
 		shaderc::CompileOptions options;
 		options.SetTargetEnvironment(shaderc_target_env_opengl, shaderc_env_version_opengl_4_5);
-		const bool optimize = false;
-		if (optimize)
-			options.SetOptimizationLevel(shaderc_optimization_level_performance);
 
-		std::filesystem::path cacheDirectory = Utils::GetCacheDirectory();
+		uint64_t optionsKey = ShaderCache::Hash(Utils::s_OpenGLCompileOptions);
 
 		shaderData.clear();
 		m_OpenGLSourceCode.clear();
 		for (auto&& [stage, spirv] : m_VulkanSPIRV)
 		{
-			std::filesystem::path shaderFilePath = m_FilePath;
-			std::filesystem::path cachedPath = cacheDirectory / (shaderFilePath.filename().string() + Utils::GLShaderStageCachedOpenGLFileExtension(stage));
-
-			std::ifstream in(cachedPath, std::ios::in | std::ios::binary);
-			if (in.is_open())
-			{
-				in.seekg(0, std::ios::end);
-				auto size = in.tellg();
-				in.seekg(0, std::ios::beg);
+			shaderData[stage];
+			m_OpenGLSourceCode[stage];
+		}
 
-				auto& data = shaderData[stage];
-				data.resize(size / sizeof(uint32_t));
-				in.read((char*)data.data(), size);
-			}
-			else
-			{
-				spirv_cross::CompilerGLSL glslCompiler(spirv);
-				m_OpenGLSourceCode[stage] = glslCompiler.compile();
-				auto& source = m_OpenGLSourceCode[stage];
-
-				shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(source, Utils::GLShaderStageToShaderC(stage), m_FilePath.c_str());
-				if (module.GetCompilationStatus() != shaderc_compilation_status_success)
-				{
-					NB_ERROR(module.GetErrorMessage());
-					NB_ASSERT(false, "");
-				}
-
-				shaderData[stage] = std::vector<uint32_t>(module.cbegin(), module.cend());
-
-				std::ofstream out(cachedPath, std::ios::out | std::ios::binary);
-				if (out.is_open())
-				{
-					auto& data = shaderData[stage];
-					out.write((char*)data.data(), data.size() * sizeof(uint32_t));
-					out.flush();
-					out.close();
-				}
-			}
+		JobCounter counter;
+		for (auto&& [stage, spirv] : m_VulkanSPIRV)
+		{
+			uint64_t key = ShaderCache::Combine(m_StageKeys.at(stage), optionsKey);
+			std::filesystem::path cachedPath = ShaderCache::GetCachePath(key, Utils::GLShaderStageCachedOpenGLFileExtension(stage));
+			auto& data = shaderData.at(stage);
+
+			if (ShaderCache::ReadBinary(cachedPath, data))
+				continue;
+
+			GLenum shaderStage = stage;
+			const std::vector<uint32_t>& vulkanSpirv = spirv;
+			std::string& source = m_OpenGLSourceCode.at(stage);
+			JobSystem::Submit("Compile OpenGL Stage", [&, shaderStage, cachedPath]() {
+				spirv_cross::CompilerGLSL glslCompiler(vulkanSpirv);
+				source = glslCompiler.compile();
+
+				if (Utils::CompileToSpirv(source, shaderStage, GetCacheName(), options, data))
+					ShaderCache::WriteBinary(cachedPath, data.data(), data.size() * sizeof(uint32_t));
+			}, &counter);
 		}
+
+		JobSystem::Wait(counter);
 	}
 
 	void OpenGL_Shader::CreateProgram()
 	{
 		GLuint program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
 		std::vector<GLuint> shaderIDs;
 		for (auto&& [stage, spirv] : m_OpenGLSPIRV)
@@ -380,76 +449,105 @@ namespace Nebula {
 		return true;
 	}
 
-	void OpenGL_Shader::CreateProgramForAmd()
+	bool OpenGL_Shader::CreateProgramFromBinary()
 	{
-		GLuint program = glCreateProgram();
+		NB_PROFILE_FUNCTION();
 
-		std::filesystem::path cacheDirectory = Utils::GetCacheDirectory();
-		std::filesystem::path shaderFilePath = m_FilePath;
-		std::filesystem::path cachedPath = cacheDirectory / (shaderFilePath.filename().string() + ".cached_opengl.pgr");
-		std::ifstream in(cachedPath, std::ios::ate | std::ios::binary);
+		ScopedBuffer binary = FileSystem::ReadFileBinary(m_ProgramBinary.BinaryPath);
+		if (!binary)
+			return false;
 
-		if (in.is_open())
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, m_ProgramBinary.BinaryFormat, binary.Data(), (GLsizei)binary.Size());
+
+		// Not an error, drivers reject binaries after updates
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
 		{
-			auto size = in.tellg();
-			in.seekg(0);
+			glDeleteProgram(program);
+			return false;
+		}
 
-			auto& data = std::vector<char>(size);
-			uint32_t format = 0;
-			in.read((char*)&format, sizeof(uint32_t));
-			in.read((char*)data.data(), size);
-			glProgramBinary(program, format, data.data(), (GLsizei)data.size());
+		m_RendererID = program;
+		return true;
+	}
 
-			bool linked = VerifyProgramLink(program);
+	void OpenGL_Shader::SaveProgramBinary()
+	{
+		NB_PROFILE_FUNCTION();
 
-			if (!linked)
-				return;
-		}
-		else
-		{
-			std::array<uint32_t, 2> glShadersIDs;
-			CompileOpenGLBinariesForAmd(program, glShadersIDs);
-			glLinkProgram(program);
+		GLint formats = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+		if (formats == 0 || !m_RendererID)
+			return;
 
-			bool linked = VerifyProgramLink(program);
+		GLint length = 0;
+		glGetProgramiv(m_RendererID, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length == 0)
+			return;
 
-			if (linked)
-			{
-				// Save program data
-				GLint formats = 0;
-				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
-				NB_ASSERT(formats > 0, "Driver does not support binary format");
-				Utils::CreateCacheDirectoryIfNeeded();
-				GLint length = 0;
-				glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
-				auto shaderData = std::vector<char>(length);
-				uint32_t format = 0;
-				glGetProgramBinary(program, length, nullptr, &format, shaderData.data());
-				std::ofstream out(cachedPath, std::ios::out | std::ios::binary);
-				if (out.is_open())
-				{
-					out.write((char*)&format, sizeof(uint32_t));
-					out.write(shaderData.data(), shaderData.size());
-					out.flush();
-					out.close();
-				}
-			}
+		std::vector<char> data(length);
+		GLenum format = 0;
+		glGetProgramBinary(m_RendererID, length, nullptr, &format, data.data());
+
+		ShaderCache::ProgramEntry entry;
+		entry.Key = m_ProgramKey;
+		entry.BinaryFormat = format;
+		entry.BinaryPath = ShaderCache::GetCachePath(m_ProgramKey, ".cached_opengl.pgr");
+
+		if (ShaderCache::WriteBinary(entry.BinaryPath, data.data(), data.size()))
+			ShaderCache::StoreProgram(GetCacheName(), entry);
+	}
+
+	void OpenGL_Shader::CreateProgramForAmd()
+	{
+		GLuint program = glCreateProgram();
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+		std::array<uint32_t, 2> glShadersIDs;
+		CompileOpenGLBinariesForAmd(program, glShadersIDs);
+		glLinkProgram(program);
+
+		if (!VerifyProgramLink(program))
+			return;
 
-			for (auto& id : glShadersIDs)
-				glDetachShader(program, id);
+		for (auto& id : glShadersIDs)
+		{
+			glDetachShader(program, id);
+			glDeleteShader(id);
 		}
 
 		m_RendererID = program;
 	}
 
-	void OpenGL_Shader::CompileOpenGLBinariesForAmd(GLenum& program, std::array<uint32_t, 2>& glShadersIDs)
+	void OpenGL_Shader::CrossCompileSourceForAmd()
 	{
-		int glShaderIDIndex = 0;
+		NB_PROFILE_FUNCTION();
+
+		m_OpenGLSourceCode.clear();
+		for (auto&& [stage, spirv] : m_VulkanSPIRV)
+			m_OpenGLSourceCode[stage];
+
+		JobCounter counter;
 		for (auto&& [stage, spirv] : m_VulkanSPIRV)
 		{
-			spirv_cross::CompilerGLSL glslCompiler(spirv);
-			auto& source = glslCompiler.compile();
+			const std::vector<uint32_t>& vulkanSpirv = spirv;
+			std::string& source = m_OpenGLSourceCode.at(stage);
+			JobSystem::Submit("Cross Compile Stage", [&]() {
+				spirv_cross::CompilerGLSL glslCompiler(vulkanSpirv);
+				source = glslCompiler.compile();
+			}, &counter);
+		}
+
+		JobSystem::Wait(counter);
+	}
 
+	void OpenGL_Shader::CompileOpenGLBinariesForAmd(GLenum& program, std::array<uint32_t, 2>& glShadersIDs)
+	{
+		int glShaderIDIndex = 0;
+		for (auto&& [stage, source] : m_OpenGLSourceCode)
+		{
 			uint32_t shader;
 
 			shader = glCreateShader(stage);
@@ -2,16 +2,20 @@
 
 #include "Nebula/renderer/Shader.h"
 #include "Nebula/Maths/Maths.h"
+#include "Nebula/Renderer/ShaderCache.h"
 
 typedef unsigned int GLenum;
 
 namespace Nebula {
 	class OpenGL_Shader: public Shader {
 	public:
-		OpenGL_Shader(const std::string& path);
+		OpenGL_Shader(const std::string& path, bool deferCompile = false);
 		OpenGL_Shader(const std::string& name, const std::string& vertSrc, const std::string& fragSrc);
 		~OpenGL_Shader();
 
+		// Runs the cpu side of every shader on its own thread, then links them on this one
+		static Array<Ref<Shader>> Create(const Array<std::string>& paths);
+
 		void Bind() const override;
 		void Unbind() const override;
 
@@ -39,16 +43,27 @@ namespace Nebula {
 		std::string ReadFile(const std::string& filepath);
 		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 
-		void CompileOrGetVulkanBinaries(const std::unordered_map<GLenum, std::string>& shaderSources);
+		const std::string& GetCacheName() const { return m_FilePath.empty() ? m_Name : m_FilePath; }
+		void CalculateCacheKeys();
+
+		// Thread safe, does not touch the gl context
+		void Compile();
+		void Link();
+
+		void CompileOrGetVulkanBinaries();
 		void CompileOrGetOpenGLBinaries();
 		void CreateProgram();
 
+		void CrossCompileSourceForAmd();
 		void CompileOpenGLBinariesForAmd(GLenum& program, std::array<uint32_t, 2>& glShadersIDs);
 		void CreateProgramForAmd();
 
+		bool CreateProgramFromBinary();
+		void SaveProgramBinary();
+
 		void Reflect(GLenum stage, const std::vector<uint32_t>& shaderData);
 	private:
-		uint32_t m_RendererID;
+		uint32_t m_RendererID = 0;
 		std::string m_FilePath;
 		std::string m_Name;
 
@@ -56,5 +71,12 @@ namespace Nebula {
 		std::unordered_map<GLenum, std::vector<uint32_t>> m_OpenGLSPIRV;
 
 		std::unordered_map<GLenum, std::string> m_OpenGLSourceCode;
+		std::unordered_map<GLenum, std::string> m_ShaderSources;
+
+		std::unordered_map<GLenum, uint64_t> m_StageKeys;
+		uint64_t m_ProgramKey = 0;
+
+		ShaderCache::ProgramEntry m_ProgramBinary;
+		bool m_HasProgramBinary = false;
 	};
 }
\ No newline at end of file
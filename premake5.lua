@@ -35,4 +35,9 @@ group "Core"
 group ""
 
 --The Nebula Editor
-include "Nebula-Storm"
\ No newline at end of file
+include "Nebula-Storm"
+
+--Benchmarks, not part of the engine or the editor
+group "Tools"
+	include "Nebula-Benchmarks"
+group ""
\ No newline at end of file